@@ -0,0 +1,206 @@
+/**
+ * @file bench_harness.hpp
+ * @brief Timing, repetition and statistics helpers for fast_math_bench
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Each benchmark case is timed in two modes:
+ * - throughput: independent outputs written to a buffer, so the CPU can
+ *   overlap consecutive calls (reciprocal throughput per element)
+ * - latency: a dependent chain where every call waits for the previous
+ *   result (true latency per call)
+ * Both run a few warmup passes and then a number of timed repetitions,
+ * summarized by their median and percentiles.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "input_distributions.hpp"
+#include "perf_counters.hpp"
+
+namespace FastMathBench
+{
+  /**
+   * @brief Keep the compiler from discarding a value computed for timing
+   */
+  template <typename T>
+  inline void
+  do_not_optimize(const T &value)
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  /**
+   * @brief Force pending stores to be treated as observable, so that repeated
+   *        passes over the same buffer are not merged or hoisted
+   */
+  inline void
+  clobber_memory()
+  {
+    asm volatile("" : : : "memory");
+  }
+
+  /**
+   * @brief Input of a latency chain: `value`, made to depend on `previous`
+   * @param mask 0 at run time but unknown to the compiler
+   * @note Done on the bit pattern rather than as value + 0 * previous, so
+   *       that an infinite or NaN result cannot leak into the next input and
+   *       subnormal inputs pass through unchanged.
+   */
+  inline float
+  chain_input(float value, float previous, std::uint32_t mask)
+  {
+    std::uint32_t value_bits;
+    std::uint32_t previous_bits;
+    std::memcpy(&value_bits, &value, sizeof(value));
+    std::memcpy(&previous_bits, &previous, sizeof(previous));
+    value_bits |= previous_bits & mask;
+    std::memcpy(&value, &value_bits, sizeof(value));
+    return value;
+  }
+
+  /**
+   * @brief One function under test
+   * @note `latency` is empty for batch entry points, which have no scalar
+   *       dependent chain to measure
+   */
+  struct Case
+  {
+    std::string name;                                                              ///< Function name, e.g. "exp"
+    std::string impl;                                                              ///< "FastMath", "std" or "batch"
+    int arity;                                                                     ///< 1 or 2 arguments
+    Domain a;                                                                      ///< Inputs of the first argument
+    Domain b;                                                                      ///< Inputs of the second argument
+    std::function<void(const float *, const float *, float *, std::size_t)> throughput;
+    std::function<float(const float *, const float *, std::size_t, std::uint32_t)> latency;
+    std::function<double(double, double)> reference;                               ///< Exact result, for ULP error
+  };
+
+  /**
+   * @brief Median and spread of a set of repetitions
+   */
+  struct Statistics
+  {
+    double median;
+    double p10;
+    double p90;
+    double min;
+  };
+
+  /**
+   * @brief Percentile by linear interpolation between closest ranks
+   * @param sorted Samples in ascending order (non-empty)
+   * @param fraction Percentile in [0, 1]
+   */
+  inline double
+  percentile(const std::vector<double> &sorted, double fraction)
+  {
+    const double position = fraction * static_cast<double>(sorted.size() - 1);
+    const std::size_t lower = static_cast<std::size_t>(position);
+    const std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+    const double weight = position - static_cast<double>(lower);
+    return sorted[lower] * (1.0 - weight) + sorted[upper] * weight;
+  }
+
+  inline Statistics
+  summarize(std::vector<double> samples)
+  {
+    std::sort(samples.begin(), samples.end());
+    Statistics stats;
+    stats.median = percentile(samples, 0.5);
+    stats.p10 = percentile(samples, 0.1);
+    stats.p90 = percentile(samples, 0.9);
+    stats.min = samples.front();
+    return stats;
+  }
+
+  /**
+   * @brief Repetition settings shared by every case
+   */
+  struct Options
+  {
+    std::size_t size = 4096;        ///< Elements per pass (4096 floats in + out fit in L1)
+    int warmup = 3;                 ///< Untimed repetitions before measuring
+    int repetitions = 15;           ///< Timed repetitions
+    double min_time_ms = 2.0;       ///< Minimum duration of one repetition
+    std::string filter;             ///< Only run cases whose "impl::name" contains this
+    std::vector<Distribution> distributions{std::begin(all_distributions), std::end(all_distributions)};
+    std::string csv_path;           ///< Also write results as CSV
+    std::string json_path;          ///< Also write results as JSON
+    std::string baseline_path;      ///< CSV of an earlier run to compare against
+    double threshold = 0.10;        ///< Relative slowdown reported as a regression
+    bool scaling = false;           ///< Run the multi-core scaling sweep instead (scaling_bench.hpp)
+    int max_threads = 0;            ///< Largest thread count of the sweep (0: every allowed CPU)
+    std::size_t max_bytes = std::size_t(1) << 30; ///< Largest one-input working set of the sweep
+  };
+
+  /**
+   * @brief Time `pass` (one pass over `elements` elements) repeatedly
+   * @param counters If non-null, enabled around all timed repetitions
+   * @param readings Receives the counter values per element
+   * @return Nanoseconds per element for each timed repetition
+   * @note The number of passes per repetition is calibrated once so that a
+   *       repetition lasts at least Options::min_time_ms, keeping clock
+   *       resolution out of the result.
+   */
+  inline std::vector<double>
+  measure(const Options &options, std::size_t elements, const std::function<void()> &pass,
+          PerfCounters *counters = nullptr, CounterReadings *readings = nullptr)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    std::size_t passes = 1;
+    for (;;)
+    {
+      const auto start = Clock::now();
+      for (std::size_t i = 0; i < passes; ++i)
+      {
+        pass();
+      }
+      const double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+      if (elapsed >= options.min_time_ms || passes >= (std::size_t(1) << 24))
+      {
+        break;
+      }
+      passes *= 2;
+    }
+
+    for (int i = 0; i < options.warmup; ++i)
+    {
+      pass();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(options.repetitions);
+    if (counters)
+    {
+      counters->start();
+    }
+    for (int r = 0; r < options.repetitions; ++r)
+    {
+      const auto start = Clock::now();
+      for (std::size_t i = 0; i < passes; ++i)
+      {
+        pass();
+      }
+      const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+      samples.push_back(elapsed / static_cast<double>(passes * elements));
+    }
+    if (counters && readings)
+    {
+      *readings = counters->stop(passes * elements * static_cast<std::size_t>(options.repetitions));
+    }
+    return samples;
+  }
+} // namespace FastMathBench
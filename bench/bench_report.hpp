@@ -0,0 +1,260 @@
+/**
+ * @file bench_report.hpp
+ * @brief Machine-readable fast_math_bench results and baseline comparison
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Results are written as CSV (one row per function, implementation and
+ * distribution) or JSON with the same fields. A CSV written by one run can
+ * be stored and passed back as the baseline of a later run, which then
+ * reports every case that got significantly slower.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "bench_harness.hpp"
+
+namespace FastMathBench
+{
+  /**
+   * @brief Everything measured for one case on one distribution
+   */
+  struct Result
+  {
+    std::string function;
+    std::string impl;
+    std::string distribution;
+    Statistics throughput;          ///< ns per element
+    bool has_latency = false;
+    Statistics latency;             ///< ns per call
+    CounterReadings counters;       ///< Throughput run
+    bool has_accuracy = false;
+    double max_ulp = 0.0;           ///< Over outputs where result and reference are finite
+    std::size_t mismatches = 0;     ///< Outputs where exactly one of them is inf/NaN
+  };
+
+  namespace detail
+  {
+    constexpr const char *csv_header =
+        "function,impl,distribution,throughput_ns,throughput_p10_ns,throughput_p90_ns,latency_ns,latency_p10_ns,"
+        "latency_p90_ns,cycles_per_elem,ipc,mispredict_rate,l1d_misses_per_elem,max_ulp,nonfinite_mismatches";
+
+    /// Writes `value`, or nothing (CSV) / null (JSON) when it is unavailable
+    inline void
+    write_optional(std::ostream &out, bool available, double value, bool json)
+    {
+      if (available)
+      {
+        out << value;
+      }
+      else if (json)
+      {
+        out << "null";
+      }
+    }
+
+    inline std::tuple<std::string, std::string, std::string>
+    key(const Result &result)
+    {
+      return std::make_tuple(result.function, result.impl, result.distribution);
+    }
+  } // namespace detail
+
+  inline void
+  write_csv(std::ostream &out, const std::vector<Result> &results)
+  {
+    out << detail::csv_header << "\n" << std::setprecision(6);
+    for (const Result &r : results)
+    {
+      out << r.function << "," << r.impl << "," << r.distribution << "," << r.throughput.median << ","
+          << r.throughput.p10 << "," << r.throughput.p90 << ",";
+      detail::write_optional(out, r.has_latency, r.latency.median, false);
+      out << ",";
+      detail::write_optional(out, r.has_latency, r.latency.p10, false);
+      out << ",";
+      detail::write_optional(out, r.has_latency, r.latency.p90, false);
+      out << ",";
+      detail::write_optional(out, r.counters.cycles() >= 0.0, r.counters.cycles(), false);
+      out << ",";
+      detail::write_optional(out, r.counters.ipc() >= 0.0, r.counters.ipc(), false);
+      out << ",";
+      detail::write_optional(out, r.counters.mispredict_rate() >= 0.0, r.counters.mispredict_rate(), false);
+      out << ",";
+      detail::write_optional(out, r.counters.l1d_misses() >= 0.0, r.counters.l1d_misses(), false);
+      out << ",";
+      detail::write_optional(out, r.has_accuracy, r.max_ulp, false);
+      out << ",";
+      if (r.has_accuracy)
+      {
+        out << r.mismatches;
+      }
+      out << "\n";
+    }
+  }
+
+  /**
+   * @brief JSON object {"config": {...}, "results": [...]}, with null for
+   *        values that were not measured
+   */
+  inline void
+  write_json(std::ostream &out, const Options &options, const std::string &isa, const std::vector<Result> &results)
+  {
+    out << std::setprecision(6);
+    out << "{\n  \"config\": {\"size\": " << options.size << ", \"warmup\": " << options.warmup
+        << ", \"repetitions\": " << options.repetitions << ", \"batch_isa\": \"" << isa << "\"},\n";
+    out << "  \"results\": [";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      const Result &r = results[i];
+      out << (i ? ",\n" : "\n") << "    {\"function\": \"" << r.function << "\", \"impl\": \"" << r.impl
+          << "\", \"distribution\": \"" << r.distribution << "\", \"throughput_ns\": " << r.throughput.median
+          << ", \"throughput_p10_ns\": " << r.throughput.p10 << ", \"throughput_p90_ns\": " << r.throughput.p90
+          << ", \"latency_ns\": ";
+      detail::write_optional(out, r.has_latency, r.latency.median, true);
+      out << ", \"latency_p10_ns\": ";
+      detail::write_optional(out, r.has_latency, r.latency.p10, true);
+      out << ", \"latency_p90_ns\": ";
+      detail::write_optional(out, r.has_latency, r.latency.p90, true);
+      out << ", \"cycles_per_elem\": ";
+      detail::write_optional(out, r.counters.cycles() >= 0.0, r.counters.cycles(), true);
+      out << ", \"ipc\": ";
+      detail::write_optional(out, r.counters.ipc() >= 0.0, r.counters.ipc(), true);
+      out << ", \"mispredict_rate\": ";
+      detail::write_optional(out, r.counters.mispredict_rate() >= 0.0, r.counters.mispredict_rate(), true);
+      out << ", \"l1d_misses_per_elem\": ";
+      detail::write_optional(out, r.counters.l1d_misses() >= 0.0, r.counters.l1d_misses(), true);
+      out << ", \"max_ulp\": ";
+      detail::write_optional(out, r.has_accuracy, r.max_ulp, true);
+      out << ", \"nonfinite_mismatches\": ";
+      detail::write_optional(out, r.has_accuracy, static_cast<double>(r.mismatches), true);
+      out << "}";
+    }
+    out << "\n  ]\n}\n";
+  }
+
+  /**
+   * @brief Read results written by write_csv (timings only)
+   * @return false if the header does not match
+   */
+  inline bool
+  read_csv(std::istream &in, std::vector<Result> &results)
+  {
+    std::string line;
+    if (!std::getline(in, line) || line != detail::csv_header)
+    {
+      return false;
+    }
+    while (std::getline(in, line))
+    {
+      std::vector<std::string> fields;
+      std::stringstream stream(line);
+      std::string field;
+      while (std::getline(stream, field, ','))
+      {
+        fields.push_back(field);
+      }
+      if (fields.size() < 9)
+      {
+        continue;
+      }
+
+      Result r;
+      r.function = fields[0];
+      r.impl = fields[1];
+      r.distribution = fields[2];
+      r.throughput.median = std::atof(fields[3].c_str());
+      r.throughput.p10 = std::atof(fields[4].c_str());
+      r.throughput.p90 = std::atof(fields[5].c_str());
+      r.has_latency = !fields[6].empty();
+      if (r.has_latency)
+      {
+        r.latency.median = std::atof(fields[6].c_str());
+        r.latency.p10 = std::atof(fields[7].c_str());
+        r.latency.p90 = std::atof(fields[8].c_str());
+      }
+      results.push_back(r);
+    }
+    return true;
+  }
+
+  /**
+   * @brief True if `current` is significantly slower than `baseline`
+   * @note Significant means the median grew by more than `threshold`
+   *       (a fraction) and the two runs' p10-p90 bands do not overlap, so a
+   *       single noisy run is not reported as a regression.
+   */
+  inline bool
+  significantly_slower(const Statistics &current, const Statistics &baseline, double threshold)
+  {
+    return current.median > baseline.median * (1.0 + threshold) && current.p10 > baseline.p90;
+  }
+
+  /**
+   * @brief Print the cases that regressed (or improved) against a baseline
+   * @param threshold Relative slowdown below which changes are ignored
+   * @return Number of significant regressions
+   */
+  inline int
+  compare_to_baseline(const std::vector<Result> &baseline, const std::vector<Result> &current, double threshold,
+                      std::ostream &out)
+  {
+    std::map<std::tuple<std::string, std::string, std::string>, const Result *> lookup;
+    for (const Result &r : baseline)
+    {
+      lookup[detail::key(r)] = &r;
+    }
+
+    int regressions = 0;
+    int improvements = 0;
+    out << std::fixed << std::setprecision(3);
+    for (const Result &r : current)
+    {
+      const auto found = lookup.find(detail::key(r));
+      if (found == lookup.end())
+      {
+        continue;
+      }
+      const Result &base = *found->second;
+
+      const auto report = [&](const char *mode, const Statistics &now, const Statistics &before) {
+        if (significantly_slower(now, before, threshold))
+        {
+          ++regressions;
+          out << "REGRESSION  ";
+        }
+        else if (significantly_slower(before, now, threshold))
+        {
+          ++improvements;
+          out << "improvement ";
+        }
+        else
+        {
+          return;
+        }
+        out << r.impl << "::" << r.function << " [" << r.distribution << "] " << mode << ": " << before.median
+            << " -> " << now.median << " ns (" << std::showpos << 100.0 * (now.median / before.median - 1.0)
+            << std::noshowpos << "%)\n";
+      };
+
+      report("throughput", r.throughput, base.throughput);
+      if (r.has_latency && base.has_latency)
+      {
+        report("latency", r.latency, base.latency);
+      }
+    }
+    out << regressions << " significant regression(s), " << improvements << " improvement(s) against baseline\n";
+    return regressions;
+  }
+} // namespace FastMathBench
@@ -0,0 +1,655 @@
+/**
+ * @file fast_math_bench.cpp
+ * @brief Throughput and latency benchmarks for every fast math function
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Usage: fast_math_bench [--filter=TEXT] [--distribution=NAME[,NAME...]]
+ *                        [--size=N] [--warmup=N] [--repetitions=N]
+ *                        [--min-time-ms=T] [--csv=FILE] [--json=FILE]
+ *                        [--baseline=CSV] [--threshold=PERCENT]
+ *        fast_math_bench --scaling [--filter=TEXT] [--threads=N]
+ *                        [--max-bytes=N] [--csv=FILE]
+ *
+ * For each function, the FastMath scalar call, the std:: counterpart and
+ * the FastMath batch entry point are measured. Throughput is nanoseconds per
+ * element with independent outputs; latency is nanoseconds per call along a
+ * dependent chain (batch calls have no latency figure). The "identity" row
+ * measures the chain itself, to be subtracted from the latency figures.
+ *
+ * Every case is run once per input distribution (sorted, uniform, gaussian,
+ * special, out-of-range, subnormal; see input_distributions.hpp), applied to
+ * each argument with that argument's Domain.
+ *
+ * --csv/--json also write the results to a file; --baseline compares them
+ * with the CSV of an earlier run (see bench_report.hpp). Exit status: 0 on
+ * success, 1 if a case regressed significantly, 2 on a usage or file error.
+ *
+ * --scaling instead runs the batch kernels of exp, log, sin and atan2 (or
+ * every batch case matching --filter) over growing buffers on 1..N pinned
+ * threads and reports how close each gets to memory bandwidth (see
+ * scaling_bench.hpp).
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_harness.hpp"
+#include "bench_report.hpp"
+#include "fast_math.hpp"
+#include "scaling_bench.hpp"
+#include "ulp.hpp"
+
+namespace FastMathBench
+{
+  namespace
+  {
+    /// Exact result in double precision (second argument unused when unary)
+    using Reference = double (*)(double, double);
+
+    /**
+     * @brief Benchmark case for a scalar function of one argument
+     */
+    template <typename Function>
+    Case
+    unary(const std::string &name, const std::string &impl, const Domain &a, Function function, Reference reference)
+    {
+      Case c;
+      c.name = name;
+      c.impl = impl;
+      c.arity = 1;
+      c.a = a;
+      c.b = a;
+      c.reference = reference;
+      c.throughput = [function](const float *in, const float *, float *out, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          out[i] = function(in[i]);
+        }
+      };
+      // Each call depends on the previous result without changing its input
+      c.latency = [function](const float *in, const float *, std::size_t n, std::uint32_t mask) {
+        float x = 0.0f;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          x = function(chain_input(in[i], x, mask));
+        }
+        return x;
+      };
+      return c;
+    }
+
+    /**
+     * @brief Benchmark case for a scalar function of two arguments; the
+     *        latency chain runs through the first argument
+     */
+    template <typename Function>
+    Case
+    binary(const std::string &name, const std::string &impl, const Domain &a, const Domain &b, Function function,
+           Reference reference)
+    {
+      Case c;
+      c.name = name;
+      c.impl = impl;
+      c.arity = 2;
+      c.a = a;
+      c.b = b;
+      c.reference = reference;
+      c.throughput = [function](const float *x, const float *y, float *out, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          out[i] = function(x[i], y[i]);
+        }
+      };
+      c.latency = [function](const float *x, const float *y, std::size_t n, std::uint32_t mask) {
+        float acc = 0.0f;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          acc = function(chain_input(x[i], acc, mask), y[i]);
+        }
+        return acc;
+      };
+      return c;
+    }
+
+    using UnaryBatch = void (*)(const float *, float *, std::size_t);
+    using BinaryBatch = void (*)(const float *, const float *, float *, std::size_t);
+
+    Case
+    unary_batch(const std::string &name, const Domain &a, UnaryBatch batch, Reference reference)
+    {
+      Case c;
+      c.name = name;
+      c.impl = "batch";
+      c.arity = 1;
+      c.a = a;
+      c.b = a;
+      c.reference = reference;
+      c.throughput = [batch](const float *in, const float *, float *out, std::size_t n) { batch(in, out, n); };
+      return c;
+    }
+
+    Case
+    binary_batch(const std::string &name, const Domain &a, const Domain &b, BinaryBatch batch, Reference reference)
+    {
+      Case c;
+      c.name = name;
+      c.impl = "batch";
+      c.arity = 2;
+      c.a = a;
+      c.b = b;
+      c.reference = reference;
+      c.throughput = [batch](const float *x, const float *y, float *out, std::size_t n) { batch(x, y, out, n); };
+      return c;
+    }
+
+// FastMath scalar, std:: scalar and FastMath batch cases for one function,
+// checked against std:: in double precision
+#define FAST_MATH_BENCH_UNARY(function, a)                                                        \
+  do                                                                                              \
+  {                                                                                               \
+    const Reference reference = [](double x, double) { return std::function(x); };                \
+    cases.push_back(unary(#function, "FastMath", a, [](float x) { return FastMath::function(x); }, reference)); \
+    cases.push_back(unary(#function, "std", a, [](float x) { return std::function(x); }, reference));           \
+    cases.push_back(unary_batch(#function, a, FastMath::function, reference));                   \
+  } while (0)
+
+#define FAST_MATH_BENCH_BINARY(function, a, b)                                                    \
+  do                                                                                              \
+  {                                                                                               \
+    const Reference reference = [](double x, double y) { return std::function(x, y); };           \
+    cases.push_back(                                                                              \
+        binary(#function, "FastMath", a, b, [](float x, float y) { return FastMath::function(x, y); }, reference)); \
+    cases.push_back(binary(#function, "std", a, b, [](float x, float y) { return std::function(x, y); }, reference)); \
+    cases.push_back(binary_batch(#function, a, b, FastMath::function, reference));               \
+  } while (0)
+
+    std::vector<Case>
+    make_cases()
+    {
+      using FastMath::Precision;
+      constexpr float pi = 3.14159265358979323846f;
+      constexpr float half_pi = 0.5f * pi;
+
+      // {lo, hi, special values and branch points, out-of-range lo, hi}
+      const Domain unit{-1.0f, 1.0f, {-1.0f, 0.0f, 1.0f}, -1e4f, 1e4f};
+      const Domain angle{-2.0f * pi, 2.0f * pi,
+                         {-2.0f * pi, -3.0f * half_pi, -pi, -half_pi, 0.0f, half_pi, pi, 3.0f * half_pi, 2.0f * pi},
+                         -2e4f, 2e4f};
+      const Domain tan_angle{-1.47f, 1.47f, {-half_pi, -1.0f, 0.0f, 1.0f, half_pi}, -2e4f, 2e4f};
+      const Domain positive{0.001f, 1000.0f, {0.0f, 1.0f, 2.0f, 10.0f}, 1e3f, 1e30f};
+      const Domain inverse_trig{-1.0f, 1.0f, {-1.0f, -0.5f, 0.0f, 0.5f, 1.0f}, -10.0f, 10.0f};
+      const Domain plane{-10.0f, 10.0f, {0.0f}, -1e6f, 1e6f};
+      const Domain exponent{-10.0f, 10.0f, {-87.0f, 0.0f, 88.0f}, -120.0f, 120.0f};
+      const Domain exponent2{-20.0f, 20.0f, {-126.0f, 0.0f, 127.0f}, -200.0f, 200.0f};
+      const Domain exponent10{-5.0f, 5.0f, {-37.0f, 0.0f, 38.0f}, -50.0f, 50.0f};
+      const Domain near_zero{-0.5f, 0.5f, {-1e-7f, 0.0f, 1e-7f}, -1e4f, 1e4f};
+      const Domain pow_base{0.1f, 10.0f, {0.0f, 1.0f}, 10.0f, 1e4f};
+      const Domain pow_exponent{-3.0f, 3.0f, {-2.0f, -1.0f, 0.0f, 0.5f, 1.0f, 2.0f, 3.0f, 4.0f}, -30.0f, 30.0f};
+      const Domain dividend{-100.0f, 100.0f, {-1.0f, 0.0f, 1.0f}, -1e9f, 1e9f};
+      const Domain divisor{0.5f, 10.0f, {1.0f}, 0.5f, 10.0f};
+      const Domain rounding{-100.0f, 100.0f, {-1.5f, -0.5f, 0.0f, 0.5f, 1.5f}, -1e9f, 1e9f};
+      const Domain hyperbolic{-5.0f, 5.0f, {-0.5f, 0.0f, 0.5f}, -100.0f, 100.0f};
+      const Domain asinh_domain{-10.0f, 10.0f, {-0.5f, 0.0f, 0.5f}, -1e6f, 1e6f};
+      const Domain acosh_domain{1.0f, 10.0f, {1.0f, 1.5f}, 1.0f, 1e6f};
+      const Domain atanh_domain{-0.99f, 0.99f, {-1.0f, -0.5f, 0.0f, 0.5f, 1.0f}, -10.0f, 10.0f};
+
+      std::vector<Case> cases;
+      const Reference identity = [](double x, double) { return x; };
+      cases.push_back(unary("identity", "baseline", unit, [](float x) { return x; }, identity));
+
+      FAST_MATH_BENCH_UNARY(sin, angle);
+      FAST_MATH_BENCH_UNARY(cos, angle);
+      FAST_MATH_BENCH_UNARY(sqrt, positive);
+      const Reference rsqrt_reference = [](double x, double) { return 1.0 / std::sqrt(x); };
+      cases.push_back(unary("rsqrt", "FastMath", positive, [](float x) { return FastMath::rsqrt(x); }, rsqrt_reference));
+      cases.push_back(unary("rsqrt", "std", positive, [](float x) { return 1.0f / std::sqrt(x); }, rsqrt_reference));
+      cases.push_back(unary_batch("rsqrt", positive, FastMath::rsqrt, rsqrt_reference));
+      FAST_MATH_BENCH_UNARY(tan, tan_angle);
+      FAST_MATH_BENCH_UNARY(asin, inverse_trig);
+      FAST_MATH_BENCH_UNARY(acos, inverse_trig);
+      FAST_MATH_BENCH_UNARY(atan, plane);
+      FAST_MATH_BENCH_BINARY(atan2, plane, plane);
+      FAST_MATH_BENCH_UNARY(exp, exponent);
+      FAST_MATH_BENCH_UNARY(exp2, exponent2);
+      const Reference exp10_reference = [](double x, double) { return std::pow(10.0, x); };
+      cases.push_back(unary("exp10", "FastMath", exponent10, [](float x) { return FastMath::exp10(x); }, exp10_reference));
+      cases.push_back(unary("exp10", "std", exponent10, [](float x) { return std::pow(10.0f, x); }, exp10_reference));
+      cases.push_back(unary_batch("exp10", exponent10, FastMath::exp10, exp10_reference));
+      FAST_MATH_BENCH_UNARY(expm1, near_zero);
+      FAST_MATH_BENCH_UNARY(log, positive);
+      FAST_MATH_BENCH_UNARY(log10, positive);
+      FAST_MATH_BENCH_UNARY(log2, positive);
+      FAST_MATH_BENCH_UNARY(log1p, near_zero);
+      FAST_MATH_BENCH_BINARY(pow, pow_base, pow_exponent);
+
+      // Fixed exponents: pow() re-classifies the exponent on every call,
+      // PowPlan and pow_batch classify it once
+      const Reference cube_reference = [](double x, double) { return x * x * x; };
+      const Reference gamma_reference = [](double x, double) { return std::pow(x, 2.2); };
+      const Reference inverse_reference = [](double x, double) { return std::pow(x, -1.5); };
+      cases.push_back(unary("pow<3>", "FastMath", pow_base, FastMath::pow<3>, cube_reference));
+      cases.push_back(unary("pow(x,2.2)", "FastMath", pow_base, [](float x) { return FastMath::pow(x, 2.2f); },
+                            gamma_reference));
+      cases.push_back(unary("pow(x,2.2)", "std", pow_base, [](float x) { return std::pow(x, 2.2f); }, gamma_reference));
+      cases.push_back(unary("pow(x,2.2)", "PowPlan", pow_base, FastMath::PowPlan(2.2f), gamma_reference));
+      cases.push_back(unary_batch(
+          "pow(x,2.2)", pow_base, [](const float *in, float *out, std::size_t n) { FastMath::pow_batch(in, out, n, 2.2f); },
+          gamma_reference));
+      cases.push_back(unary("pow(x,-1.5)", "FastMath", pow_base, [](float x) { return FastMath::pow(x, -1.5f); },
+                            inverse_reference));
+      cases.push_back(unary("pow(x,-1.5)", "std", pow_base, [](float x) { return std::pow(x, -1.5f); },
+                            inverse_reference));
+      cases.push_back(unary("pow(x,-1.5)", "PowPlan", pow_base, FastMath::PowPlan(-1.5f), inverse_reference));
+      cases.push_back(unary_batch(
+          "pow(x,-1.5)", pow_base,
+          [](const float *in, float *out, std::size_t n) { FastMath::pow_batch(in, out, n, -1.5f); }, inverse_reference));
+      FAST_MATH_BENCH_BINARY(fmod, dividend, divisor);
+
+      // One divisor for the whole array: angle wrapping over large ranges
+      const Domain wide_angle{-1e4f, 1e4f, {-pi, 0.0f, pi}, -1e9f, 1e9f};
+      const Reference fmod_two_pi_reference = [](double x, double) { return std::fmod(x, double(2.0f * pi)); };
+      const Reference wrap_reference = [](double x, double) {
+        // [-pi, pi) in float: a result that rounds to float(pi) wraps to -float(pi)
+        const double r = std::remainder(x, 2.0 * 3.14159265358979323846);
+        return (static_cast<float>(r) >= pi) ? r - 2.0 * 3.14159265358979323846 : r;
+      };
+      cases.push_back(unary("fmod(x,2pi)", "FastMath", wide_angle, [](float x) { return FastMath::fmod(x, 2.0f * pi); },
+                            fmod_two_pi_reference));
+      cases.push_back(unary("fmod(x,2pi)", "std", wide_angle, [](float x) { return std::fmod(x, 2.0f * pi); },
+                            fmod_two_pi_reference));
+      cases.push_back(unary_batch(
+          "fmod(x,2pi)", wide_angle,
+          [](const float *in, float *out, std::size_t n) { FastMath::fmod_batch(in, out, n, 2.0f * pi); },
+          fmod_two_pi_reference));
+      cases.push_back(unary("wrap_angle", "FastMath", wide_angle, [](float x) { return FastMath::wrap_angle(x); },
+                            wrap_reference));
+      cases.push_back(unary_batch("wrap_angle", wide_angle, FastMath::wrap_angle, wrap_reference));
+      FAST_MATH_BENCH_UNARY(ceil, rounding);
+      FAST_MATH_BENCH_UNARY(floor, rounding);
+      FAST_MATH_BENCH_UNARY(round, rounding);
+      FAST_MATH_BENCH_UNARY(sinh, hyperbolic);
+      FAST_MATH_BENCH_UNARY(cosh, hyperbolic);
+      FAST_MATH_BENCH_UNARY(tanh, hyperbolic);
+      FAST_MATH_BENCH_UNARY(asinh, asinh_domain);
+      FAST_MATH_BENCH_UNARY(acosh, acosh_domain);
+      FAST_MATH_BENCH_UNARY(atanh, atanh_domain);
+
+      cases.push_back(unary(
+          "sincos", "FastMath", angle,
+          [](float x) {
+            float s;
+            float c;
+            FastMath::sincos(x, &s, &c);
+            return s + c;
+          },
+          [](double x, double) { return std::sin(x) + std::cos(x); }));
+
+      // Precision tiers (Medium is the untemplated row above)
+      const Reference sin_reference = [](double x, double) { return std::sin(x); };
+      const Reference cos_reference = [](double x, double) { return std::cos(x); };
+      const Reference exp_reference = [](double x, double) { return std::exp(x); };
+      const Reference log_reference = [](double x, double) { return std::log(x); };
+      const Reference atan_reference = [](double x, double) { return std::atan(x); };
+      const Reference atan2_reference = [](double y, double x) { return std::atan2(y, x); };
+      // Large accumulated angles: the reduction is constant time, so the
+      // latency column should match the sin row
+      const Domain large_angle{1e5f, 1e6f, {1e5f, 1e6f}, 1e9f, 1e11f};
+      cases.push_back(unary("sin(large)", "FastMath", large_angle, [](float x) { return FastMath::sin(x); },
+                            sin_reference));
+      cases.push_back(unary("sin(large)", "std", large_angle, [](float x) { return std::sin(x); }, sin_reference));
+      cases.push_back(unary_batch("sin(large)", large_angle, FastMath::sin, sin_reference));
+      cases.push_back(unary("sin<Low>", "FastMath", angle, FastMath::sin<Precision::Low>, sin_reference));
+      cases.push_back(unary("sin<High>", "FastMath", angle, FastMath::sin<Precision::High>, sin_reference));
+      cases.push_back(unary("cos<Low>", "FastMath", angle, FastMath::cos<Precision::Low>, cos_reference));
+      cases.push_back(unary("cos<High>", "FastMath", angle, FastMath::cos<Precision::High>, cos_reference));
+      cases.push_back(unary("exp<Low>", "FastMath", exponent, FastMath::exp<Precision::Low>, exp_reference));
+      cases.push_back(unary("exp<High>", "FastMath", exponent, FastMath::exp<Precision::High>, exp_reference));
+      cases.push_back(unary("log<Low>", "FastMath", positive, FastMath::log<Precision::Low>, log_reference));
+      cases.push_back(unary("log<High>", "FastMath", positive, FastMath::log<Precision::High>, log_reference));
+      cases.push_back(unary("atan<Low>", "FastMath", plane, FastMath::atan<Precision::Low>, atan_reference));
+      cases.push_back(unary("atan<High>", "FastMath", plane, FastMath::atan<Precision::High>, atan_reference));
+      cases.push_back(binary("atan2<Low>", "FastMath", plane, plane, FastMath::atan2<Precision::Low>, atan2_reference));
+      cases.push_back(binary("atan2<High>", "FastMath", plane, plane, FastMath::atan2<Precision::High>, atan2_reference));
+      return cases;
+    }
+
+#undef FAST_MATH_BENCH_UNARY
+#undef FAST_MATH_BENCH_BINARY
+
+    /**
+     * @brief Parse "--key=value" arguments into options
+     * @return false on an unknown argument or --help
+     */
+    bool
+    parse_options(int argc, char **argv, Options &options)
+    {
+      for (int i = 1; i < argc; ++i)
+      {
+        const std::string arg = argv[i];
+        const std::size_t equals = arg.find('=');
+        const std::string key = arg.substr(0, equals);
+        const std::string value = (equals == std::string::npos) ? "" : arg.substr(equals + 1);
+
+        if (key == "--filter")
+          options.filter = value;
+        else if (key == "--distribution")
+        {
+          options.distributions.clear();
+          std::size_t begin = 0;
+          while (begin <= value.size())
+          {
+            const std::size_t comma = std::min(value.find(',', begin), value.size());
+            Distribution distribution;
+            if (!parse_distribution(value.substr(begin, comma - begin), distribution))
+              return false;
+            options.distributions.push_back(distribution);
+            begin = comma + 1;
+          }
+        }
+        else if (key == "--size")
+          options.size = std::strtoul(value.c_str(), nullptr, 10);
+        else if (key == "--warmup")
+          options.warmup = std::atoi(value.c_str());
+        else if (key == "--repetitions")
+          options.repetitions = std::atoi(value.c_str());
+        else if (key == "--min-time-ms")
+          options.min_time_ms = std::atof(value.c_str());
+        else if (key == "--csv")
+          options.csv_path = value;
+        else if (key == "--json")
+          options.json_path = value;
+        else if (key == "--baseline")
+          options.baseline_path = value;
+        else if (key == "--threshold")
+          options.threshold = std::atof(value.c_str()) / 100.0;
+        else if (key == "--scaling")
+          options.scaling = true;
+        else if (key == "--threads")
+          options.max_threads = std::atoi(value.c_str());
+        else if (key == "--max-bytes")
+          options.max_bytes = std::strtoull(value.c_str(), nullptr, 10);
+        else
+          return false;
+      }
+      if (options.scaling && (!options.json_path.empty() || !options.baseline_path.empty()))
+        return false;
+      return options.size > 0 && options.repetitions > 0 && options.warmup >= 0 && options.max_threads >= 0;
+    }
+
+    void
+    print_usage(const char *program)
+    {
+      std::cerr << "Usage: " << program
+                << " [--filter=TEXT] [--distribution=NAME[,NAME...]] [--size=N] [--warmup=N] [--repetitions=N]"
+                   " [--min-time-ms=T]\n"
+                << "       [--csv=FILE] [--json=FILE] [--baseline=CSV] [--threshold=PERCENT]\n"
+                << "       " << program << " --scaling [--filter=TEXT] [--threads=N] [--max-bytes=N] [--csv=FILE]\n"
+                << "Distributions:";
+      for (Distribution distribution : all_distributions)
+      {
+        std::cerr << " " << distribution_name(distribution);
+      }
+      std::cerr << "\n";
+    }
+
+    const char *
+    isa_name(FastMath::Isa isa)
+    {
+      switch (isa)
+      {
+      case FastMath::Isa::AVX512:
+        return "avx512";
+      case FastMath::Isa::AVX2:
+        return "avx2";
+      default:
+        return "generic";
+      }
+    }
+
+    /**
+     * @brief Max ULP error of `out` against the case's reference
+     */
+    void
+    measure_accuracy(const Case &c, const std::vector<float> &a, const std::vector<float> &b,
+                     const std::vector<float> &out, Result &result)
+    {
+      result.has_accuracy = true;
+      for (std::size_t i = 0; i < out.size(); ++i)
+      {
+        double ulps = 0.0;
+        switch (ulp_error(out[i], c.reference(a[i], b[i]), ulps))
+        {
+        case UlpCheck::Match:
+          result.max_ulp = std::max(result.max_ulp, ulps);
+          break;
+        case UlpCheck::Mismatch:
+          ++result.mismatches;
+          break;
+        case UlpCheck::Special:
+          break;
+        }
+      }
+    }
+
+    void
+    print_statistics(const Statistics &stats)
+    {
+      std::cout << std::setw(9) << stats.median << " [" << std::setw(7) << stats.p10 << ", " << std::setw(7)
+                << stats.p90 << "]";
+    }
+
+    void
+    print_counter(double value, double scale, int precision)
+    {
+      if (value < 0.0)
+      {
+        std::cout << std::setw(9) << "-";
+      }
+      else
+      {
+        std::cout << std::setw(9) << std::setprecision(precision) << value * scale << std::setprecision(3);
+      }
+    }
+
+    /**
+     * @brief fast_math_bench --scaling
+     * @return Exit status
+     */
+    int
+    run_scaling_mode(const Options &options)
+    {
+      std::vector<Case> cases;
+      for (const Case &c : make_cases())
+      {
+        const bool selected = options.filter.empty()
+                                  ? (c.name == "exp" || c.name == "log" || c.name == "sin" || c.name == "atan2")
+                                  : c.name.find(options.filter) != std::string::npos;
+        if (c.impl == "batch" && selected)
+        {
+          cases.push_back(c);
+        }
+      }
+
+      std::cout << "fast_math_bench --scaling: batch ISA " << isa_name(FastMath::active_isa()) << ", "
+                << allowed_cpus().size() << " CPUs, working sets up to " << options.max_bytes << " bytes\n";
+      std::cout << "roof = streaming copy (1 input) or add (2 inputs) over the same buffers and threads\n\n";
+      const std::vector<ScalingResult> results = run_scaling(options, cases, std::cout);
+
+      if (!options.csv_path.empty())
+      {
+        std::ofstream file(options.csv_path);
+        write_scaling_csv(file, results);
+        if (!file)
+        {
+          std::cerr << "Cannot write " << options.csv_path << "\n";
+          return 2;
+        }
+      }
+      return 0;
+    }
+
+    /// cycles/elem, IPC, branch mispredict %, L1D read misses/elem
+    void
+    print_counters(const CounterReadings &readings)
+    {
+      print_counter(readings.cycles(), 1.0, 2);
+      print_counter(readings.ipc(), 1.0, 2);
+      print_counter(readings.mispredict_rate(), 100.0, 2);
+      print_counter(readings.l1d_misses(), 1.0, 4);
+    }
+  } // namespace
+} // namespace FastMathBench
+
+int
+main(int argc, char **argv)
+{
+  using namespace FastMathBench;
+
+  Options options;
+  if (!parse_options(argc, argv, options))
+  {
+    print_usage(argv[0]);
+    return 2;
+  }
+  if (options.scaling)
+  {
+    return run_scaling_mode(options);
+  }
+
+  // Load the baseline first, so a bad path fails before the long run
+  std::vector<Result> baseline;
+  if (!options.baseline_path.empty())
+  {
+    std::ifstream file(options.baseline_path);
+    if (!file || !read_csv(file, baseline))
+    {
+      std::cerr << "Cannot read baseline CSV " << options.baseline_path << "\n";
+      return 2;
+    }
+  }
+
+  // Read at run time so the compiler cannot drop the latency chain
+  volatile std::uint32_t mask_source = 0;
+  const std::uint32_t mask = mask_source;
+
+  std::cout << "fast_math_bench: " << options.size << " elements per pass, " << options.warmup << " warmup + "
+            << options.repetitions << " repetitions, batch ISA " << isa_name(FastMath::active_isa()) << "\n";
+  std::cout << "Times in ns per element: median [p10, p90]\n";
+
+  // Counters cover the timed throughput repetitions
+  PerfCounters counters;
+  if (counters.available())
+  {
+    std::cout << "Counters (throughput run): cycles/elem, IPC, branch mispredict %, L1D read misses/elem\n\n";
+  }
+  else
+  {
+    std::cout << "Hardware counters unavailable (" << counters.error() << "), wall-clock times only\n\n";
+  }
+
+  std::cout << std::fixed << std::setprecision(3);
+
+  const std::vector<Case> cases = make_cases();
+  std::vector<Result> results;
+  std::vector<float> out(options.size);
+  for (Distribution distribution : options.distributions)
+  {
+    std::cout << "== " << distribution_name(distribution) << " ==\n";
+    std::cout << std::left << std::setw(12) << "function" << std::setw(10) << "impl" << std::right << std::setw(30)
+              << "throughput";
+    if (counters.available())
+    {
+      std::cout << std::setw(9) << "cyc/el" << std::setw(9) << "IPC" << std::setw(9) << "brmiss%" << std::setw(9)
+                << "L1D/el";
+    }
+    std::cout << std::setw(12) << "max ulp" << std::setw(30) << "latency"
+              << "\n";
+
+    for (const Case &c : cases)
+    {
+      if (!options.filter.empty() && (c.impl + "::" + c.name).find(options.filter) == std::string::npos)
+      {
+        continue;
+      }
+
+      const std::vector<float> a = generate_inputs(c.a, distribution, options.size, 1);
+      const std::vector<float> b = generate_inputs(c.b, distribution, options.size, 2);
+
+      Result result;
+      result.function = c.name;
+      result.impl = c.impl;
+      result.distribution = distribution_name(distribution);
+      result.throughput = summarize(measure(
+          options, options.size,
+          [&] {
+            c.throughput(a.data(), b.data(), out.data(), out.size());
+            clobber_memory();
+          },
+          &counters, &result.counters));
+      measure_accuracy(c, a, b, out, result);
+
+      std::cout << std::left << std::setw(12) << c.name << std::setw(10) << c.impl << std::right << "   ";
+      print_statistics(result.throughput);
+      if (counters.available())
+      {
+        print_counters(result.counters);
+      }
+      std::cout << std::setw(12) << std::setprecision(1) << result.max_ulp << std::setprecision(3);
+
+      if (c.latency)
+      {
+        result.has_latency = true;
+        result.latency = summarize(measure(options, options.size, [&] {
+          do_not_optimize(c.latency(a.data(), b.data(), a.size(), mask));
+        }));
+        std::cout << "   ";
+        print_statistics(result.latency);
+      }
+      if (result.mismatches)
+      {
+        std::cout << "   (" << result.mismatches << " inf/NaN mismatches)";
+      }
+      std::cout << "\n";
+      results.push_back(result);
+    }
+    std::cout << "\n";
+  }
+
+  if (!options.csv_path.empty())
+  {
+    std::ofstream file(options.csv_path);
+    write_csv(file, results);
+    if (!file)
+    {
+      std::cerr << "Cannot write " << options.csv_path << "\n";
+      return 2;
+    }
+  }
+  if (!options.json_path.empty())
+  {
+    std::ofstream file(options.json_path);
+    write_json(file, options, isa_name(FastMath::active_isa()), results);
+    if (!file)
+    {
+      std::cerr << "Cannot write " << options.json_path << "\n";
+      return 2;
+    }
+  }
+
+  if (!options.baseline_path.empty() && compare_to_baseline(baseline, results, options.threshold, std::cout) > 0)
+  {
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,410 @@
+/**
+ * @file fast_math_ulp_sweep.cpp
+ * @brief Exhaustive ULP accuracy sweep of the single-argument functions
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Usage: fast_math_ulp_sweep [--threads=N] [--stride=N] [--lo=X] [--hi=X]
+ *                            [FUNCTION...]
+ *
+ * Evaluates each function on every float of its domain (or on every N-th
+ * float with --stride) and compares it against the std:: function in double
+ * precision. Reports the largest error in ULPs with its location and a
+ * histogram of the errors. The range is split into chunks that the worker
+ * threads take from a shared counter, so all cores stay busy even where
+ * some functions are slower on part of the range.
+ *
+ * Built without -ffast-math, so the double-precision reference is the
+ * correctly handled libm result.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fast_math.hpp"
+#include "ulp.hpp"
+
+namespace
+{
+  using namespace FastMathBench;
+
+  /**
+   * @brief One function under test and the inputs it is defined on
+   */
+  struct SweepFunction
+  {
+    const char *name;
+    float (*function)(float);
+    double (*reference)(double);
+    float lo; ///< Smallest input of the default domain
+    float hi; ///< Largest input of the default domain
+  };
+
+  double
+  reciprocal_sqrt(double x)
+  {
+    return 1.0 / std::sqrt(x);
+  }
+
+  /// One element through the dispatched batch kernel, which differs from
+  /// the scalar sqrt on AVX2/AVX-512 (x * rsqrt(x))
+  float
+  batch_sqrt(float x)
+  {
+    float result;
+    FastMath::sqrt(&x, &result, 1);
+    return result;
+  }
+
+  double
+  exp10(double x)
+  {
+    return std::pow(10.0, x);
+  }
+
+  const std::vector<SweepFunction> &
+  sweep_functions()
+  {
+    using FastMath::Precision;
+    constexpr float max = FLT_MAX;
+    constexpr float tiny = FLT_TRUE_MIN;
+
+    static const std::vector<SweepFunction> functions = {
+        {"sin", FastMath::sin, std::sin, -max, max},
+        {"cos", FastMath::cos, std::cos, -max, max},
+        {"tan", FastMath::tan, std::tan, -max, max},
+        {"asin", FastMath::asin, std::asin, -1.0f, 1.0f},
+        {"acos", FastMath::acos, std::acos, -1.0f, 1.0f},
+        {"atan", FastMath::atan, std::atan, -max, max},
+        {"sqrt", FastMath::sqrt, std::sqrt, 0.0f, max},
+        {"rsqrt", FastMath::rsqrt, reciprocal_sqrt, FLT_MIN, max},
+        {"sqrt_batch", batch_sqrt, std::sqrt, FLT_MIN, max},
+        {"exp", FastMath::exp, std::exp, -max, max},
+        {"exp2", FastMath::exp2, std::exp2, -max, max},
+        {"exp10", FastMath::exp10, exp10, -max, max},
+        {"expm1", FastMath::expm1, std::expm1, -max, max},
+        {"log", FastMath::log, std::log, tiny, max},
+        {"log10", FastMath::log10, std::log10, tiny, max},
+        {"log2", FastMath::log2, std::log2, tiny, max},
+        {"log1p", FastMath::log1p, std::log1p, -1.0f, max},
+        {"ceil", FastMath::ceil, std::ceil, -max, max},
+        {"floor", FastMath::floor, std::floor, -max, max},
+        {"round", FastMath::round, std::round, -max, max},
+        {"sinh", FastMath::sinh, std::sinh, -max, max},
+        {"cosh", FastMath::cosh, std::cosh, -max, max},
+        {"tanh", FastMath::tanh, std::tanh, -max, max},
+        {"asinh", FastMath::asinh, std::asinh, -max, max},
+        {"acosh", FastMath::acosh, std::acosh, 1.0f, max},
+        {"atanh", FastMath::atanh, std::atanh, -1.0f, 1.0f},
+        {"sin<Low>", FastMath::sin<Precision::Low>, std::sin, -max, max},
+        {"sin<High>", FastMath::sin<Precision::High>, std::sin, -max, max},
+        {"cos<Low>", FastMath::cos<Precision::Low>, std::cos, -max, max},
+        {"cos<High>", FastMath::cos<Precision::High>, std::cos, -max, max},
+        {"exp<Low>", FastMath::exp<Precision::Low>, std::exp, -max, max},
+        {"exp<High>", FastMath::exp<Precision::High>, std::exp, -max, max},
+        {"log<Low>", FastMath::log<Precision::Low>, std::log, tiny, max},
+        {"log<High>", FastMath::log<Precision::High>, std::log, tiny, max},
+        {"atan<Low>", FastMath::atan<Precision::Low>, std::atan, -max, max},
+        {"atan<High>", FastMath::atan<Precision::High>, std::atan, -max, max},
+    };
+    return functions;
+  }
+
+  /**
+   * Floats mapped to integers in the same order (-0 and +0 both map to 0),
+   * so that a range of floats is a range of integers
+   */
+  std::int64_t
+  float_to_ordinal(float value)
+  {
+    const std::uint32_t bits = float_bits(value);
+    const std::int64_t magnitude = bits & 0x7FFFFFFFu;
+    return (bits & 0x80000000u) ? -magnitude : magnitude;
+  }
+
+  float
+  ordinal_to_float(std::int64_t ordinal)
+  {
+    const std::uint32_t bits = (ordinal < 0) ? (static_cast<std::uint32_t>(-ordinal) | 0x80000000u)
+                                             : static_cast<std::uint32_t>(ordinal);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // Histogram buckets: <= 0.5 ulp, <= 1 ulp, <= 2^k ulp for k = 1..20, larger
+  constexpr int bucket_count = 23;
+
+  int
+  bucket_of(double ulps)
+  {
+    if (ulps <= 0.5)
+    {
+      return 0;
+    }
+    for (int k = 0; k <= 20; ++k)
+    {
+      if (ulps <= std::ldexp(1.0, k))
+      {
+        return k + 1;
+      }
+    }
+    return bucket_count - 1;
+  }
+
+  /**
+   * @brief Errors accumulated by one thread, merged at the end
+   */
+  struct SweepResult
+  {
+    std::uint64_t inputs = 0;
+    std::uint64_t mismatches = 0;
+    std::uint64_t histogram[bucket_count] = {};
+    double max_ulp = -1.0;
+    float worst_input = 0.0f;
+    float worst_result = 0.0f;
+    double worst_reference = 0.0;
+    float first_mismatch = 0.0f;   ///< One input with a mismatch (the first one seen by a thread)
+
+    void
+    merge(const SweepResult &other)
+    {
+      inputs += other.inputs;
+      if (other.mismatches && !mismatches)
+      {
+        first_mismatch = other.first_mismatch;
+      }
+      mismatches += other.mismatches;
+      for (int i = 0; i < bucket_count; ++i)
+      {
+        histogram[i] += other.histogram[i];
+      }
+      if (other.max_ulp > max_ulp)
+      {
+        max_ulp = other.max_ulp;
+        worst_input = other.worst_input;
+        worst_result = other.worst_result;
+        worst_reference = other.worst_reference;
+      }
+    }
+  };
+
+  SweepResult
+  sweep(const SweepFunction &f, float lo, float hi, std::int64_t stride, unsigned thread_count)
+  {
+    const std::int64_t first = float_to_ordinal(lo);
+    const std::int64_t last = float_to_ordinal(hi);
+    const std::int64_t chunk = stride << 16;
+    std::atomic<std::int64_t> next(first);
+
+    std::vector<SweepResult> partial(thread_count);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < thread_count; ++t)
+    {
+      threads.emplace_back([&, t] {
+        SweepResult &result = partial[t];
+        for (;;)
+        {
+          const std::int64_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+          if (begin > last)
+          {
+            break;
+          }
+          const std::int64_t end = std::min(begin + chunk - 1, last);
+          for (std::int64_t ordinal = begin; ordinal <= end; ordinal += stride)
+          {
+            const float x = ordinal_to_float(ordinal);
+            const float y = f.function(x);
+            const double reference = f.reference(static_cast<double>(x));
+            ++result.inputs;
+
+            double ulps = 0.0;
+            switch (ulp_error(y, reference, ulps))
+            {
+            case UlpCheck::Match:
+              ++result.histogram[bucket_of(ulps)];
+              if (ulps > result.max_ulp)
+              {
+                result.max_ulp = ulps;
+                result.worst_input = x;
+                result.worst_result = y;
+                result.worst_reference = reference;
+              }
+              break;
+            case UlpCheck::Mismatch:
+              if (!result.mismatches)
+              {
+                result.first_mismatch = x;
+              }
+              ++result.mismatches;
+              break;
+            case UlpCheck::Special:
+              ++result.histogram[0];
+              break;
+            }
+          }
+        }
+      });
+    }
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+
+    SweepResult total;
+    for (const auto &result : partial)
+    {
+      total.merge(result);
+    }
+    return total;
+  }
+
+  void
+  print_result(const SweepFunction &f, float lo, float hi, const SweepResult &result, double seconds)
+  {
+    std::cout << std::defaultfloat << std::setprecision(9);
+    std::cout << f.name << ": " << result.inputs << " inputs in [" << lo << ", " << hi << "], " << std::fixed
+              << std::setprecision(1) << seconds << " s\n";
+    if (result.max_ulp >= 0.0)
+    {
+      std::cout << "  max " << std::setprecision(2) << result.max_ulp << " ulp at x = " << std::defaultfloat
+                << std::setprecision(9) << result.worst_input << " (0x" << std::hex << std::setw(8)
+                << std::setfill('0') << float_bits(result.worst_input) << std::dec << std::setfill(' ')
+                << "): got " << result.worst_result << ", expected " << std::setprecision(17)
+                << result.worst_reference << "\n";
+    }
+    if (result.mismatches)
+    {
+      std::cout << "  " << result.mismatches << " inf/NaN mismatches, e.g. at x = " << std::setprecision(9)
+                << result.first_mismatch << "\n";
+    }
+
+    std::cout << "  histogram:";
+    for (int i = 0; i < bucket_count; ++i)
+    {
+      if (!result.histogram[i])
+      {
+        continue;
+      }
+      const double share = 100.0 * static_cast<double>(result.histogram[i]) / static_cast<double>(result.inputs);
+      std::cout << "\n    ";
+      if (i == 0)
+        std::cout << "<= 0.5 ulp ";
+      else if (i == bucket_count - 1)
+        std::cout << " > 2^20 ulp";
+      else
+        std::cout << "<= 2^" << std::setw(2) << std::left << (i - 1) << std::right << " ulp";
+      std::cout << std::setw(14) << result.histogram[i] << std::fixed << std::setprecision(4) << std::setw(10)
+                << share << " %";
+    }
+    std::cout << "\n\n";
+  }
+
+  void
+  print_usage(const char *program)
+  {
+    std::cerr << "Usage: " << program << " [--threads=N] [--stride=N] [--lo=X] [--hi=X] [FUNCTION...]\nFunctions:";
+    for (const auto &f : sweep_functions())
+    {
+      std::cerr << " " << f.name;
+    }
+    std::cerr << "\n";
+  }
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  unsigned thread_count = std::max(1u, std::thread::hardware_concurrency());
+  std::int64_t stride = 1;
+  bool has_lo = false;
+  bool has_hi = false;
+  float lo_override = 0.0f;
+  float hi_override = 0.0f;
+  std::vector<std::string> names;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const std::size_t equals = arg.find('=');
+    const std::string key = arg.substr(0, equals);
+    const std::string value = (equals == std::string::npos) ? "" : arg.substr(equals + 1);
+
+    if (key == "--threads")
+      thread_count = static_cast<unsigned>(std::max(1, std::atoi(value.c_str())));
+    else if (key == "--stride")
+      stride = std::max<std::int64_t>(1, std::atoll(value.c_str()));
+    else if (key == "--lo")
+    {
+      has_lo = true;
+      lo_override = std::strtof(value.c_str(), nullptr);
+    }
+    else if (key == "--hi")
+    {
+      has_hi = true;
+      hi_override = std::strtof(value.c_str(), nullptr);
+    }
+    else if (key.compare(0, 2, "--") == 0)
+    {
+      print_usage(argv[0]);
+      return 2;
+    }
+    else
+      names.push_back(arg);
+  }
+
+  std::vector<const SweepFunction *> selected;
+  for (const auto &name : names)
+  {
+    const auto &functions = sweep_functions();
+    const auto found = std::find_if(functions.begin(), functions.end(),
+                                    [&](const SweepFunction &f) { return name == f.name; });
+    if (found == functions.end())
+    {
+      std::cerr << "Unknown function " << name << "\n";
+      print_usage(argv[0]);
+      return 2;
+    }
+    selected.push_back(&*found);
+  }
+  if (selected.empty())
+  {
+    for (const auto &f : sweep_functions())
+    {
+      selected.push_back(&f);
+    }
+  }
+
+  std::cout << "fast_math_ulp_sweep: " << thread_count << " threads, "
+            << (stride == 1 ? std::string("every float") : "every " + std::to_string(stride) + "th float") << "\n\n";
+
+  for (const SweepFunction *f : selected)
+  {
+    const float lo = has_lo ? std::max(lo_override, f->lo) : f->lo;
+    const float hi = has_hi ? std::min(hi_override, f->hi) : f->hi;
+    if (!(lo <= hi))
+    {
+      std::cout << f->name << ": empty domain\n\n";
+      continue;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const SweepResult result = sweep(*f, lo, hi, stride, thread_count);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    print_result(*f, lo, hi, result, seconds);
+  }
+  return 0;
+}
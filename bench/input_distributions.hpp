@@ -0,0 +1,183 @@
+/**
+ * @file input_distributions.hpp
+ * @brief Input generators for fast_math_bench
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * A sorted ramp makes every data-dependent branch perfectly predictable, so
+ * each case is also measured on inputs that look like production data
+ * (random) and on inputs that stress the slow or special paths.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace FastMathBench
+{
+  /**
+   * @brief Input distributions
+   */
+  enum class Distribution
+  {
+    Sorted,     ///< Increasing ramp over the domain, as in the gtest performance tests
+    Uniform,    ///< Uniform random over the domain
+    Gaussian,   ///< Normal around the domain centre, sigma = width / 6, clamped
+    Special,    ///< Clustered around the function's special values and branch points
+    OutOfRange, ///< Uniform over a much wider range (e.g. |theta| ~ 1e4 for sin)
+    Subnormal   ///< Subnormal magnitudes, signed if the domain includes negatives
+  };
+
+  constexpr Distribution all_distributions[] = {Distribution::Sorted,  Distribution::Uniform,
+                                                Distribution::Gaussian, Distribution::Special,
+                                                Distribution::OutOfRange, Distribution::Subnormal};
+
+  inline const char *
+  distribution_name(Distribution distribution)
+  {
+    switch (distribution)
+    {
+    case Distribution::Sorted:
+      return "sorted";
+    case Distribution::Uniform:
+      return "uniform";
+    case Distribution::Gaussian:
+      return "gaussian";
+    case Distribution::Special:
+      return "special";
+    case Distribution::OutOfRange:
+      return "out-of-range";
+    case Distribution::Subnormal:
+      return "subnormal";
+    }
+    return "";
+  }
+
+  /**
+   * @brief Look up a distribution by its name()
+   * @return false if the name is unknown
+   */
+  inline bool
+  parse_distribution(const std::string &name, Distribution &distribution)
+  {
+    for (Distribution d : all_distributions)
+    {
+      if (name == distribution_name(d))
+      {
+        distribution = d;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Inputs of one argument
+   */
+  struct Domain
+  {
+    float lo;                    ///< Typical range, lower bound
+    float hi;                    ///< Typical range, upper bound
+    std::vector<float> specials; ///< Centres for Distribution::Special (typical range if empty)
+    float wide_lo;               ///< Range for Distribution::OutOfRange
+    float wide_hi;
+  };
+
+  /**
+   * @brief Generate `n` inputs for one argument
+   * @param seed Fixed per argument, so every case sees the same sequence
+   */
+  inline std::vector<float>
+  generate_inputs(const Domain &domain, Distribution distribution, std::size_t n, unsigned seed)
+  {
+    std::mt19937 engine(seed);
+    std::vector<float> values(n);
+
+    switch (distribution)
+    {
+    case Distribution::Sorted:
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        values[i] = domain.lo + (domain.hi - domain.lo) * static_cast<float>(i) / static_cast<float>(n);
+      }
+      break;
+
+    case Distribution::Uniform:
+    {
+      std::uniform_real_distribution<float> uniform(domain.lo, domain.hi);
+      for (auto &value : values)
+      {
+        value = uniform(engine);
+      }
+      break;
+    }
+
+    case Distribution::Gaussian:
+    {
+      std::normal_distribution<float> normal(0.5f * (domain.lo + domain.hi), (domain.hi - domain.lo) / 6.0f);
+      for (auto &value : values)
+      {
+        value = std::min(std::max(normal(engine), domain.lo), domain.hi);
+      }
+      break;
+    }
+
+    case Distribution::Special:
+    {
+      // Each value is a random special point plus a small relative jitter,
+      // so both sides of every branch are taken unpredictably
+      if (domain.specials.empty())
+      {
+        return generate_inputs(domain, Distribution::Uniform, n, seed);
+      }
+      std::uniform_int_distribution<std::size_t> pick(0, domain.specials.size() - 1);
+      std::uniform_real_distribution<float> jitter(-1e-3f, 1e-3f);
+      std::bernoulli_distribution exact(0.25);
+      for (auto &value : values)
+      {
+        const float centre = domain.specials[pick(engine)];
+        value = exact(engine) ? centre : centre + jitter(engine) * std::max(1.0f, std::abs(centre));
+      }
+      break;
+    }
+
+    case Distribution::OutOfRange:
+    {
+      std::uniform_real_distribution<float> uniform(domain.wide_lo, domain.wide_hi);
+      for (auto &value : values)
+      {
+        value = uniform(engine);
+      }
+      break;
+    }
+
+    case Distribution::Subnormal:
+    {
+      // Built from bit patterns (exponent field 0) so that nothing in the
+      // generator itself can flush them; the mantissa is shifted by a random
+      // amount to cover every subnormal binade
+      std::bernoulli_distribution negative(domain.lo < 0.0f ? 0.5 : 0.0);
+      for (auto &value : values)
+      {
+        std::uint32_t bits = (engine() & 0x7FFFFFu) >> (engine() % 23);
+        bits = std::max<std::uint32_t>(bits, 1u);
+        if (negative(engine))
+        {
+          bits |= 0x80000000u;
+        }
+        std::memcpy(&value, &bits, sizeof(value));
+      }
+      break;
+    }
+    }
+    return values;
+  }
+} // namespace FastMathBench
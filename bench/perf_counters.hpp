@@ -0,0 +1,227 @@
+/**
+ * @file perf_counters.hpp
+ * @brief Hardware performance counters for fast_math_bench (Linux perf_event_open)
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Counts cycles, instructions, branches, branch misses and L1D read misses
+ * of the calling thread in user space. Each event is opened on its own, so a
+ * counter that the CPU or kernel does not provide only blanks its column.
+ * Off Linux, in containers without PMU access, or with
+ * kernel.perf_event_paranoid > 2 nothing opens and the benchmark reports
+ * wall-clock times only.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace FastMathBench
+{
+  /**
+   * @brief Events read by PerfCounters
+   */
+  enum Counter
+  {
+    Cycles,
+    Instructions,
+    Branches,
+    BranchMisses,
+    L1DMisses,
+    CounterCount
+  };
+
+  /**
+   * @brief Counter values of one measured region, per element
+   */
+  struct CounterReadings
+  {
+    bool valid[CounterCount] = {};      ///< Whether the event was counted
+    double per_element[CounterCount] = {};
+
+    double
+    cycles() const
+    {
+      return valid[Cycles] ? per_element[Cycles] : -1.0;
+    }
+
+    /// Instructions per cycle, or -1 if not counted
+    double
+    ipc() const
+    {
+      return (valid[Cycles] && valid[Instructions] && per_element[Cycles] > 0.0)
+                 ? per_element[Instructions] / per_element[Cycles]
+                 : -1.0;
+    }
+
+    /// Fraction of branches mispredicted, or -1 if not counted
+    double
+    mispredict_rate() const
+    {
+      return (valid[Branches] && valid[BranchMisses] && per_element[Branches] > 0.0)
+                 ? per_element[BranchMisses] / per_element[Branches]
+                 : -1.0;
+    }
+
+    double
+    l1d_misses() const
+    {
+      return valid[L1DMisses] ? per_element[L1DMisses] : -1.0;
+    }
+  };
+
+  /**
+   * @brief Per-thread counter set, enabled around a measured region
+   */
+  class PerfCounters
+  {
+  public:
+    PerfCounters()
+    {
+      for (int &fd : fds_)
+      {
+        fd = -1;
+      }
+#ifdef __linux__
+      const std::uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      fds_[Cycles] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+      fds_[Instructions] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+      fds_[Branches] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS);
+      fds_[BranchMisses] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+      fds_[L1DMisses] = open_event(PERF_TYPE_HW_CACHE, l1d_read_miss);
+#else
+      error_ = "perf_event_open is Linux only";
+#endif
+    }
+
+    ~PerfCounters()
+    {
+#ifdef __linux__
+      for (int fd : fds_)
+      {
+        if (fd >= 0)
+        {
+          close(fd);
+        }
+      }
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    /// True if at least one event could be opened
+    bool
+    available() const
+    {
+      for (int fd : fds_)
+      {
+        if (fd >= 0)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /// Reason the first event failed to open (empty if all opened)
+    const std::string &
+    error() const
+    {
+      return error_;
+    }
+
+    /// Reset and enable every open event
+    void
+    start()
+    {
+#ifdef __linux__
+      for (int fd : fds_)
+      {
+        if (fd >= 0)
+        {
+          ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+          ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+      }
+#endif
+    }
+
+    /**
+     * @brief Disable every event and read it
+     * @param elements Elements processed since start(), to normalize by
+     * @note Counts are scaled by time_enabled / time_running when the kernel
+     *       had to multiplex events onto fewer hardware counters.
+     */
+    CounterReadings
+    stop(std::size_t elements)
+    {
+      CounterReadings readings;
+#ifdef __linux__
+      for (int fd : fds_)
+      {
+        if (fd >= 0)
+        {
+          ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+      }
+      for (int i = 0; i < CounterCount; ++i)
+      {
+        // value, time_enabled, time_running
+        std::uint64_t data[3] = {};
+        if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) ||
+            data[2] == 0 || elements == 0)
+        {
+          continue;
+        }
+        const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        readings.valid[i] = true;
+        readings.per_element[i] = static_cast<double>(data[0]) * scale / static_cast<double>(elements);
+      }
+#else
+      (void)elements;
+#endif
+      return readings;
+    }
+
+  private:
+#ifdef __linux__
+    int
+    open_event(std::uint32_t type, std::uint64_t config)
+    {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = type;
+      attr.config = config;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+      if (fd < 0 && error_.empty())
+      {
+        error_ = std::string("perf_event_open: ") + std::strerror(errno);
+      }
+      return static_cast<int>(fd);
+    }
+#endif
+
+    int fds_[CounterCount];
+    std::string error_;
+  };
+} // namespace FastMathBench
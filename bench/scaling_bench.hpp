@@ -0,0 +1,449 @@
+/**
+ * @file scaling_bench.hpp
+ * @brief Multi-core scaling of the batch kernels (fast_math_bench --scaling)
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Each batch case is run over buffers from L1-resident up to Options::
+ * max_bytes, split evenly over 1, 2, 4, ... pinned threads. Next to the
+ * element rate, every row reports the bytes the kernel streams per second
+ * as a fraction of a plain streaming loop (copy for one input, add for two)
+ * over the same buffers and threads. That loop does no arithmetic, so it is
+ * the bandwidth roof of the working set's level of the memory hierarchy:
+ * a kernel close to 100% is memory-bound there, one well below it is
+ * compute-bound and would gain from more cores or cheaper math.
+ *
+ * Every thread first-touches its own slice of the buffers, so on NUMA
+ * machines the pages live on the node of the core that streams them.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "bench_harness.hpp"
+
+namespace FastMathBench
+{
+  /**
+   * @brief CPUs this process may run on, in ascending order
+   * @note Threads are pinned to them in this order, so thread counts below
+   *       the core count fill the lowest-numbered CPUs first.
+   */
+  inline std::vector<int>
+  allowed_cpus()
+  {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+      {
+        if (CPU_ISSET(cpu, &set))
+        {
+          cpus.push_back(cpu);
+        }
+      }
+    }
+#endif
+    if (cpus.empty())
+    {
+      const int count = std::max(1u, std::thread::hardware_concurrency());
+      for (int cpu = 0; cpu < count; ++cpu)
+      {
+        cpus.push_back(cpu);
+      }
+    }
+    return cpus;
+  }
+
+  /**
+   * @brief Fixed set of pinned worker threads that run one task at a time
+   * @note The calling thread only waits, so it does not compete with the
+   *       workers for a core.
+   */
+  class Team
+  {
+  public:
+    /**
+     * @param threads Number of workers
+     * @param cpus Worker i is pinned to cpus[i % cpus.size()]
+     */
+    Team(int threads, const std::vector<int> &cpus)
+    {
+      workers_.reserve(threads);
+      for (int i = 0; i < threads; ++i)
+      {
+        workers_.emplace_back([this, i] { work(i); });
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpus[i % cpus.size()], &set);
+        pinned_ = pthread_setaffinity_np(workers_.back().native_handle(), sizeof(set), &set) == 0 && pinned_;
+#else
+        (void)cpus;
+        pinned_ = false;
+#endif
+      }
+    }
+
+    ~Team()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        ++generation_;
+      }
+      start_.notify_all();
+      for (auto &worker : workers_)
+      {
+        worker.join();
+      }
+    }
+
+    Team(const Team &) = delete;
+    Team &operator=(const Team &) = delete;
+
+    int
+    size() const
+    {
+      return static_cast<int>(workers_.size());
+    }
+
+    /// True if every worker could be pinned to its CPU
+    bool
+    pinned() const
+    {
+      return pinned_;
+    }
+
+    /// Run task(worker index) on every worker and wait for all of them
+    void
+    run(const std::function<void(int)> &task)
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_ = &task;
+      pending_ = size();
+      ++generation_;
+      start_.notify_all();
+      done_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+  private:
+    void
+    work(int index)
+    {
+      unsigned seen = 0;
+      for (;;)
+      {
+        const std::function<void(int)> *task;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          start_.wait(lock, [&] { return generation_ != seen; });
+          seen = generation_;
+          if (stop_)
+          {
+            return;
+          }
+          task = task_;
+        }
+        (*task)(index);
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (--pending_ == 0)
+          {
+            done_.notify_one();
+          }
+        }
+      }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    const std::function<void(int)> *task_ = nullptr;
+    unsigned generation_ = 0;
+    int pending_ = 0;
+    bool stop_ = false;
+    bool pinned_ = true;
+  };
+
+  /**
+   * @brief One case at one buffer size and thread count
+   */
+  struct ScalingResult
+  {
+    std::string function;
+    std::size_t elements;
+    std::size_t bytes;              ///< Working set: inputs and output
+    int threads;
+    double elements_per_second;     ///< Median over the repetitions
+    double bytes_per_second;
+    double roof_bytes_per_second;   ///< Streaming loop over the same buffers
+  };
+
+  namespace detail
+  {
+    /// Start of worker `index`'s slice of `n` elements split `threads` ways
+    inline std::size_t
+    slice_begin(std::size_t n, int threads, int index)
+    {
+      return n / threads * index + std::min<std::size_t>(index, n % threads);
+    }
+
+    /**
+     * @brief Time `pass(worker, passes)` on the whole team
+     * @return Median elements per second over Options::repetitions
+     * @note Each worker repeats its slice `passes` times per task, with
+     *       `passes` calibrated so that a repetition lasts at least 20 ms
+     *       and waking the team stays negligible.
+     */
+    inline double
+    measure_team(const Options &options, Team &team, std::size_t elements,
+                 const std::function<void(int, std::size_t)> &pass)
+    {
+      using Clock = std::chrono::steady_clock;
+      const double min_ms = std::max(options.min_time_ms, 20.0);
+
+      std::size_t passes = 1;
+      const auto timed_run = [&] {
+        const std::function<void(int)> task = [&](int worker) { pass(worker, passes); };
+        const auto start = Clock::now();
+        team.run(task);
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+      };
+
+      // Calibration doubles as warmup; huge buffers need a single pass
+      while (timed_run() < min_ms && passes < (std::size_t(1) << 24))
+      {
+        passes *= 2;
+      }
+      for (int i = 0; i < options.warmup; ++i)
+      {
+        timed_run();
+      }
+
+      std::vector<double> samples;
+      for (int r = 0; r < options.repetitions; ++r)
+      {
+        samples.push_back(1e-3 * timed_run() / static_cast<double>(passes * elements));
+      }
+      return 1.0 / summarize(samples).median;
+    }
+  } // namespace detail
+
+  /**
+   * @brief Element counts of the sweep: a 16 KiB working set for one-input
+   *        kernels, growing 4x up to `max_bytes`
+   */
+  inline std::vector<std::size_t>
+  scaling_sizes(std::size_t max_bytes)
+  {
+    std::vector<std::size_t> sizes;
+    for (std::size_t elements = 2048; elements * 2 * sizeof(float) <= max_bytes; elements *= 4)
+    {
+      sizes.push_back(elements);
+    }
+    return sizes;
+  }
+
+  /// 1, 2, 4, ... up to `max_threads`, which is always included
+  inline std::vector<int>
+  scaling_thread_counts(int max_threads)
+  {
+    std::vector<int> counts;
+    for (int threads = 1; threads < max_threads; threads *= 2)
+    {
+      counts.push_back(threads);
+    }
+    counts.push_back(max_threads);
+    return counts;
+  }
+
+  /**
+   * @brief Run every case over every size and thread count
+   * @param cases Batch cases; only `throughput`, `arity` and the domains
+   *        are used
+   */
+  inline std::vector<ScalingResult>
+  run_scaling(const Options &options, const std::vector<Case> &cases, std::ostream &out)
+  {
+    const std::vector<int> cpus = allowed_cpus();
+    const int max_threads = options.max_threads > 0 ? options.max_threads : static_cast<int>(cpus.size());
+    const std::vector<std::size_t> sizes = scaling_sizes(options.max_bytes);
+    bool binary = false;
+    for (const Case &c : cases)
+    {
+      binary = binary || c.arity == 2;
+    }
+
+    // One period of inputs per case, tiled over the buffers
+    constexpr std::size_t period = 65536;
+    std::vector<std::vector<float>> a_inputs;
+    std::vector<std::vector<float>> b_inputs;
+    for (const Case &c : cases)
+    {
+      a_inputs.push_back(generate_inputs(c.a, Distribution::Uniform, period, 1));
+      b_inputs.push_back(generate_inputs(c.b, Distribution::Uniform, period, 2));
+    }
+
+    std::vector<ScalingResult> results;
+    for (int threads : scaling_thread_counts(max_threads))
+    {
+      Team team(threads, cpus);
+      for (std::size_t n : sizes)
+      {
+        // Allocated without initialization; each worker touches its own slice
+        std::unique_ptr<float[]> a(new float[n]);
+        std::unique_ptr<float[]> b(binary ? new float[n] : nullptr);
+        std::unique_ptr<float[]> output(new float[n]);
+        const auto slice = [&](int worker, std::size_t &begin, std::size_t &count) {
+          begin = detail::slice_begin(n, threads, worker);
+          count = detail::slice_begin(n, threads, worker + 1) - begin;
+        };
+        const auto fill = [&](std::size_t input) {
+          team.run([&](int worker) {
+            std::size_t begin;
+            std::size_t count;
+            slice(worker, begin, count);
+            for (std::size_t i = begin; i < begin + count; ++i)
+            {
+              a[i] = a_inputs[input][i % period];
+              if (b)
+              {
+                b[i] = b_inputs[input][i % period];
+              }
+              output[i] = 0.0f;
+            }
+          });
+        };
+        fill(0);
+
+        // Bandwidth roofs: the same traffic as a one- or two-input kernel
+        const double copy_rate = detail::measure_team(options, team, n, [&](int worker, std::size_t passes) {
+          std::size_t begin;
+          std::size_t count;
+          slice(worker, begin, count);
+          for (std::size_t p = 0; p < passes; ++p)
+          {
+            std::memcpy(output.get() + begin, a.get() + begin, count * sizeof(float));
+            clobber_memory();
+          }
+        });
+        double add_rate = 0.0;
+        if (binary)
+        {
+          add_rate = detail::measure_team(options, team, n, [&](int worker, std::size_t passes) {
+            std::size_t begin;
+            std::size_t count;
+            slice(worker, begin, count);
+            for (std::size_t p = 0; p < passes; ++p)
+            {
+              for (std::size_t i = begin; i < begin + count; ++i)
+              {
+                output[i] = a[i] + b[i];
+              }
+              clobber_memory();
+            }
+          });
+        }
+
+        for (std::size_t k = 0; k < cases.size(); ++k)
+        {
+          const Case &c = cases[k];
+          fill(k);
+          const double rate = detail::measure_team(options, team, n, [&](int worker, std::size_t passes) {
+            std::size_t begin;
+            std::size_t count;
+            slice(worker, begin, count);
+            for (std::size_t p = 0; p < passes; ++p)
+            {
+              c.throughput(a.get() + begin, b ? b.get() + begin : a.get() + begin, output.get() + begin, count);
+              clobber_memory();
+            }
+          });
+
+          ScalingResult result;
+          result.function = c.name;
+          result.elements = n;
+          result.threads = threads;
+          const std::size_t element_bytes = sizeof(float) * (c.arity + 1);
+          result.bytes = n * element_bytes;
+          result.elements_per_second = rate;
+          result.bytes_per_second = rate * element_bytes;
+          result.roof_bytes_per_second = (c.arity == 2 ? add_rate : copy_rate) * element_bytes;
+          results.push_back(result);
+        }
+      }
+      if (!team.pinned())
+      {
+        out << "(threads could not be pinned to CPUs)\n";
+      }
+    }
+
+    // One table per function, rows by size then thread count
+    out << std::fixed;
+    for (const Case &c : cases)
+    {
+      out << "== " << c.name << " (" << sizeof(float) * (c.arity + 1) << " bytes/elem) ==\n";
+      out << std::setw(12) << "working set" << std::setw(9) << "threads" << std::setw(11) << "Gelem/s" << std::setw(10)
+          << "GB/s" << std::setw(11) << "roof GB/s" << std::setw(8) << "% roof" << std::setw(10) << "speedup"
+          << "\n";
+      for (std::size_t n : sizes)
+      {
+        double single = 0.0;
+        for (const ScalingResult &r : results)
+        {
+          if (r.function != c.name || r.elements != n)
+          {
+            continue;
+          }
+          single = (r.threads == 1) ? r.elements_per_second : single;
+          const double kib = static_cast<double>(r.bytes) / 1024.0;
+          out << std::setprecision(0) << std::setw(8)
+              << (kib < 1024.0 ? kib : (kib < 1048576.0 ? kib / 1024.0 : kib / 1048576.0))
+              << (kib < 1024.0 ? " KiB" : (kib < 1048576.0 ? " MiB" : " GiB")) << std::setw(9) << r.threads
+              << std::setprecision(3) << std::setw(11) << r.elements_per_second * 1e-9 << std::setprecision(2)
+              << std::setw(10) << r.bytes_per_second * 1e-9 << std::setw(11) << r.roof_bytes_per_second * 1e-9
+              << std::setprecision(0) << std::setw(7) << 100.0 * r.bytes_per_second / r.roof_bytes_per_second << "%"
+              << std::setprecision(2) << std::setw(9) << r.elements_per_second / single << "x\n";
+        }
+      }
+      out << "\n";
+    }
+    return results;
+  }
+
+  /// One row per case, size and thread count
+  inline void
+  write_scaling_csv(std::ostream &out, const std::vector<ScalingResult> &results)
+  {
+    out << "function,elements,bytes,threads,elements_per_s,bytes_per_s,roof_bytes_per_s\n" << std::setprecision(6);
+    for (const ScalingResult &r : results)
+    {
+      out << r.function << "," << r.elements << "," << r.bytes << "," << r.threads << "," << r.elements_per_second
+          << "," << r.bytes_per_second << "," << r.roof_bytes_per_second << "\n";
+    }
+  }
+} // namespace FastMathBench
@@ -0,0 +1,92 @@
+/**
+ * @file ulp.hpp
+ * @brief ULP error against a double-precision reference
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * The benchmarks are built with -ffast-math, under which std::isnan and
+ * std::isinf may be folded to false, so special values are classified on
+ * the bit pattern instead.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace FastMathBench
+{
+  inline std::uint32_t
+  float_bits(float value)
+  {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  /// True for infinities and NaNs
+  inline bool
+  is_nonfinite(float value)
+  {
+    return (float_bits(value) & 0x7F800000u) == 0x7F800000u;
+  }
+
+  inline bool
+  is_nan(float value)
+  {
+    return (float_bits(value) & 0x7FFFFFFFu) > 0x7F800000u;
+  }
+
+  /**
+   * @brief Spacing of floats at the magnitude of a finite `reference`
+   * @note For |reference| below FLT_MIN this is the subnormal spacing 2^-149.
+   */
+  inline double
+  ulp_of(double reference)
+  {
+    if (reference == 0.0)
+    {
+      return std::ldexp(1.0, -149);
+    }
+    int exponent;
+    std::frexp(reference, &exponent);
+    // Floats in [2^(e-1), 2^e) are spaced 2^(e-24) apart, down to 2^-149
+    return std::ldexp(1.0, (exponent - 24 < -149) ? -149 : exponent - 24);
+  }
+
+  /**
+   * @brief Result of comparing one output against its reference
+   */
+  enum class UlpCheck
+  {
+    Match,    ///< Both finite; error is in ulps
+    Special,  ///< Both the same infinity, or both NaN
+    Mismatch  ///< Exactly one of them is non-finite, or infinities differ
+  };
+
+  /**
+   * @brief Error of `result` in units in the last place of the reference
+   * @param reference Exact value in double precision
+   * @param ulps Set when the return value is UlpCheck::Match
+   */
+  inline UlpCheck
+  ulp_error(float result, double reference, double &ulps)
+  {
+    const float rounded = static_cast<float>(reference);
+    const bool result_special = is_nonfinite(result);
+    const bool reference_special = is_nonfinite(rounded);
+    if (result_special || reference_special)
+    {
+      if (result_special && reference_special &&
+          (is_nan(result) ? is_nan(rounded) : float_bits(result) == float_bits(rounded)))
+      {
+        return UlpCheck::Special;
+      }
+      return UlpCheck::Mismatch;
+    }
+    ulps = std::abs(static_cast<double>(result) - reference) / ulp_of(reference);
+    return UlpCheck::Match;
+  }
+} // namespace FastMathBench
@@ -9,6 +9,42 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#define FAST_MATH_HAS_SPAN 1
+#endif
+
+// FAST_MATH_HEADER_ONLY: define (or link fast_math_cpp_header_only) to get
+// inline definitions of every function from fast_math_impl.hpp instead of
+// linking the compiled library.
+#ifdef FAST_MATH_HEADER_ONLY
+#define FAST_MATH_INLINE inline
+#else
+#define FAST_MATH_INLINE
+#endif
+
+// FAST_MATH_VECTOR_ABI: the library also exports vector-ABI variants of
+// sin, cos, tanh, atan, atan2 and the exp/log family (libmvec naming, e.g.
+// _ZGVdN8v__ZN8FastMath3sinEf for 8 lanes of AVX2), so compilers can
+// auto-vectorize plain loops over the scalar API. Set by CMake when the
+// library is built with GCC, which generates the variants. Not used with
+// FAST_MATH_PROFILE, whose counters make the functions impure.
+#if defined(FAST_MATH_VECTOR_ABI) && !defined(FAST_MATH_PROFILE) &&                                                     \
+    !(defined(FAST_MATH_HEADER_ONLY) && defined(__clang__))
+// The functions are also declared const (result depends only on the
+// arguments), so loops calling them need no `#pragma omp simd` to vectorize.
+#if defined(_OPENMP) || defined(__clang__)
+#define FAST_MATH_DECLARE_SIMD _Pragma("omp declare simd notinbranch") __attribute__((__const__))
+#elif defined(__GNUC__) && __GNUC__ >= 6
+#define FAST_MATH_DECLARE_SIMD __attribute__((__simd__("notinbranch"), __const__))
+#endif
+#endif
+
+#ifndef FAST_MATH_DECLARE_SIMD
+#define FAST_MATH_DECLARE_SIMD
+#endif
 
 namespace FastMath
 {
@@ -18,6 +54,7 @@ namespace FastMath
    * @return Sine value
    * @note Reference: https://yuqlid.sakura.ne.jp/dokuwiki/fast_sin_cos
    */
+  FAST_MATH_DECLARE_SIMD
   float sin(float theta);
 
   /**
@@ -26,44 +63,81 @@ namespace FastMath
    * @return Cosine value
    * @note Reference: https://yuqlid.sakura.ne.jp/dokuwiki/fast_sin_cos
    */
+  FAST_MATH_DECLARE_SIMD
   float cos(float theta);
 
   /**
-   * @brief Fast square root using Newton-Raphson method
+   * @brief Fast sine and cosine of the same angle
+   * @param theta Angle in radians
+   * @param sin_out Receives sin(theta)
+   * @param cos_out Receives cos(theta)
+   * @note Reduces theta once and evaluates both parabolas from the reduced
+   *       angle; same results as calling sin() and cos() separately
+   */
+  void sincos(float theta, float *sin_out, float *cos_out);
+
+  /**
+   * @brief Square root
    * @param number Input number
-   * @return Square root of the input number
-   * @note This function uses Newton-Raphson iteration for high precision
+   * @return Square root of the input number, 0 for number <= 0
+   * @note A single hardware instruction (sqrtss, fsqrt), correctly rounded
    */
   float sqrt(float number);
 
+  /**
+   * @brief Fast reciprocal square root
+   * @param number Input number
+   * @return 1 / sqrt(number), 1e38 for number <= 0 or subnormal
+   * @note rsqrtss estimate refined by one Newton-Raphson step, without a
+   *       division; max relative error 2.5e-7 (two steps from a bit-trick
+   *       guess where SSE is not available)
+   */
+  float rsqrt(float number);
+
   /**
    * @brief Fast tangent
    * @param angle Angle in radians
    * @return Tangent value
-   * @note Uses sin/cos ratio for accuracy
+   * @note Uses the sin/cos ratio from a single sincos() call
    */
   float tan(float theta);
 
   /**
-   * @brief Fast arc sine using Newton-Raphson method
+   * @brief Fast arc sine using a minimax polynomial
    * @param x Input value [-1, 1]
    * @return Arc sine in radians
+   * @note Uses the sqrt((1 - |x|) / 2) transform near ±1
    */
   float asin(float x);
 
   /**
-   * @brief Fast arc cosine using Newton-Raphson method
+   * @brief Fast arc cosine using a minimax polynomial
    * @param x Input value [-1, 1]
    * @return Arc cosine in radians
+   * @note Uses the sqrt((1 - |x|) / 2) transform near ±1
    */
   float acos(float x);
 
+  /**
+   * @brief Fast arc tangent
+   * @param x Input value
+   * @return Arc tangent in radians [-π/2, π/2]
+   * @note Degree-11 odd minimax polynomial on [0, 1], folded with
+   *       atan(x) = π/2 - atan(1/x) above 1; max abs error 4e-6
+   */
+  FAST_MATH_DECLARE_SIMD
+  float atan(float x);
+
   /**
    * @brief Fast arc tangent 2 (atan2)
    * @param y Y coordinate
    * @param x X coordinate
    * @return Arc tangent in radians [-π, π]
+   * @note Same polynomial as atan() on min(|x|, |y|) / max(|x|, |y|), then
+   *       octant and quadrant selects; max abs error 4e-6. |x| < 1e-7 is
+   *       treated as the y axis.
    */
+  FAST_MATH_DECLARE_SIMD
   float atan2(float y, float x);
 
   /**
@@ -72,32 +146,81 @@ namespace FastMath
    * @return e^x
    * @note Uses optimized polynomial approximation and bit manipulation
    */
+  FAST_MATH_DECLARE_SIMD
   float exp(float x);
 
+  /**
+   * @brief Fast base-2 exponential
+   * @param x Input value
+   * @return 2^x; 1e38 above 127, 0 below -126
+   * @note Same reduction and polynomial as exp(), without the scaling by
+   *       1/ln(2): integer x gives exact powers of two
+   */
+  FAST_MATH_DECLARE_SIMD
+  float exp2(float x);
+
+  /**
+   * @brief Fast base-10 exponential
+   * @param x Input value
+   * @return 10^x; 1e38 above 38, 0 below -37
+   * @note exp() reduction on x * log2(10)
+   */
+  FAST_MATH_DECLARE_SIMD
+  float exp10(float x);
+
+  /**
+   * @brief Fast exp(x) - 1, accurate near zero
+   * @param x Input value
+   * @return e^x - 1; 1e38 above 88, -1 below -87
+   * @note Evaluates the exp() polynomial without its constant term and
+   *       combines it with 2^n as 2^n * p + (2^n - 1), so |x| < ln(2)/2
+   *       keeps full relative precision instead of cancelling against 1.
+   *       Max relative error 1.2e-5 at |x| = ln(2)/2, falling as x^5
+   *       toward 0.
+   */
+  FAST_MATH_DECLARE_SIMD
+  float expm1(float x);
+
   /**
    * @brief Fast natural logarithm
    * @param x Input value (x > 0)
    * @return ln(x)
    * @note Uses bit manipulation and polynomial approximation
    */
+  FAST_MATH_DECLARE_SIMD
   float log(float x);
 
   /**
    * @brief Fast base-10 logarithm
    * @param x Input value (x > 0)
    * @return log10(x)
-   * @note Uses log(x) / log(10)
+   * @note log() reduction with the mantissa centred on 1; the exponent is
+   *       scaled by log10(2) and the mantissa series by 1/ln(10) separately
    */
+  FAST_MATH_DECLARE_SIMD
   float log10(float x);
 
   /**
    * @brief Fast base-2 logarithm
    * @param x Input value (x > 0)
    * @return log2(x)
-   * @note Uses log(x) / log(2)
+   * @note log() reduction with the mantissa centred on 1; the binary
+   *       exponent is added exactly, so powers of two give exact results
    */
+  FAST_MATH_DECLARE_SIMD
   float log2(float x);
 
+  /**
+   * @brief Fast log(1 + x), accurate near zero
+   * @param x Input value (x > -1)
+   * @return ln(1 + x); -1e38 for x <= -1
+   * @note Reduces u = 1 + x like log() and adds the rounding error of u
+   *       back as (x - (u - 1)) / u, so tiny x keep full relative
+   *       precision. Max relative error 3e-7.
+   */
+  FAST_MATH_DECLARE_SIMD
+  float log1p(float x);
+
   /**
    * @brief Fast power function
    * @param base Base value
@@ -116,6 +239,14 @@ namespace FastMath
    */
   float fmod(float dividend, float divisor);
 
+  /**
+   * @brief Wrap an angle into [-π, π)
+   * @param theta Angle in radians
+   * @return theta - 2πk for the integer k that lands in [-π, π)
+   * @note Same reduction as sin: float accuracy for |theta| up to about 1e9
+   */
+  float wrap_angle(float theta);
+
   /**
    * @brief Fast ceiling function
    * @param x Input value
@@ -162,6 +293,7 @@ namespace FastMath
    * @return tanh(x) = sinh(x) / cosh(x)
    * @note Uses optimized rational approximation for better performance
    */
+  FAST_MATH_DECLARE_SIMD
   float tanh(float x);
 
   /**
@@ -188,4 +320,634 @@ namespace FastMath
    */
   float atanh(float x);
 
-} // namespace FastMath
\ No newline at end of file
+  // ---------------------------------------------------------------------------
+  // Precision tiers
+  //
+  // sin, cos, exp, log, atan and atan2 also come as templates that select the polynomial
+  // degree and reduction strategy at compile time, e.g.
+  // FastMath::exp<FastMath::Precision::Low>(x). The untemplated functions
+  // are the Medium tier. Error bounds below were measured against double
+  // precision libm on dense sweeps of the stated domains.
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @brief Accuracy/speed tradeoff of the templated functions
+   */
+  enum class Precision
+  {
+    Low,    ///< Cheapest polynomial, for approximate work such as softmax
+    Medium, ///< Default; same results as the untemplated functions
+    High    ///< Extended-precision reduction and minimax polynomials, a few ulp
+  };
+
+  /**
+   * @brief Sine with a compile-time precision tier
+   * @param theta Angle in radians
+   * @return Sine value
+   * @note Low: parabola without the P correction, max abs error 0.056.
+   *       Medium: max abs error 1.1e-3. Neither bound is relative, so the
+   *       ulp error is unbounded near the zeros.
+   *       High: reduction by π in double and a degree-11 minimax polynomial,
+   *       max 2.1 ulp. Measured on [-1e5, 1e5].
+   */
+  template <Precision P>
+  float sin(float theta);
+
+  /**
+   * @brief Cosine with a compile-time precision tier
+   * @param theta Angle in radians
+   * @return Cosine value
+   * @note Same tiers and bounds as sin<P>
+   */
+  template <Precision P>
+  float cos(float theta);
+
+  /**
+   * @brief Exponential with a compile-time precision tier
+   * @param x Input value
+   * @return e^x
+   * @note Low: 2nd-order polynomial, max 1.1e5 ulp (0.7% relative).
+   *       Medium: 5th-order Taylor polynomial, max 83 ulp.
+   *       High: reduction in double and a 6th-order minimax polynomial,
+   *       max 1.4 ulp. Measured on [-87, 88].
+   */
+  template <Precision P>
+  float exp(float x);
+
+  /**
+   * @brief Natural logarithm with a compile-time precision tier
+   * @param x Input value (x > 0)
+   * @return ln(x)
+   * @note Low: 2-term atanh series, max abs error 1.8e-3.
+   *       Medium: 5-term series, max abs error 8.5e-6 (large ulp error
+   *       just below 1).
+   *       High: mantissa centred on [√½, √2) and a split ln 2,
+   *       max 2.7 ulp. Measured on [1e-30, 1e30].
+   */
+  template <Precision P>
+  float log(float x);
+
+  /**
+   * @brief Arc tangent with a compile-time precision tier
+   * @param x Input value
+   * @return Arc tangent in radians [-π/2, π/2]
+   * @note Low: a * (π/4 + 0.273 * (1 - a)) on a = min(|x|, 1/|x|), max abs
+   *       error 4e-3.
+   *       Medium: degree-11 odd minimax polynomial, max abs error 4e-6.
+   *       High: ratio folded around tan(π/8) with (a - 1) / (a + 1) and a
+   *       degree-9 odd minimax polynomial, max abs error 1.4e-7 (3 ulp)
+   *       in atan, 2.6e-7 in atan2. Each tier costs
+   *       one division and no branches.
+   */
+  template <Precision P>
+  float atan(float x);
+
+  /**
+   * @brief Arc tangent 2 with a compile-time precision tier
+   * @param y Y coordinate
+   * @param x X coordinate
+   * @return Arc tangent in radians [-π, π]
+   * @note Same tiers as atan<P>, on min(|x|, |y|) / max(|x|, |y|).
+   *       Low and Medium treat |x| < 1e-7 as the y axis; High only maps
+   *       (0, 0) to 0, so tiny vectors keep their direction.
+   */
+  template <Precision P>
+  float atan2(float y, float x);
+
+  // ---------------------------------------------------------------------------
+  // Fixed exponents
+  //
+  // pow(base, exponent) classifies the exponent on every call. When it is
+  // known at compile time (pow<N>) or fixed for a whole array (PowPlan,
+  // pow_batch), the classification happens once and each element runs a
+  // straight-line kernel. Zero and negative bases follow pow(): 0^e is 0
+  // for e > 0 and 1e38 for e < 0, negative bases with a fractional
+  // exponent give 0.
+  // ---------------------------------------------------------------------------
+
+  namespace detail
+  {
+    /**
+     * @brief x^N, N >= 0, by repeated squaring expanded at compile time
+     */
+    template <int N, typename T>
+    inline T
+    power_by_squaring(T x)
+    {
+      if constexpr (N == 0)
+      {
+        return T(1);
+      }
+      else if constexpr (N == 1)
+      {
+        return x;
+      }
+      else
+      {
+        const T half = power_by_squaring<N / 2>(x);
+        if constexpr (N % 2 == 0)
+        {
+          return half * half;
+        }
+        else
+        {
+          return half * half * x;
+        }
+      }
+    }
+  } // namespace detail
+
+  /**
+   * @brief x^N for a compile-time integer exponent
+   * @param x Base value
+   * @return x^N by repeated squaring, expanded at compile time (x^5 is
+   *         three multiplications); for N < 0, 1 / x^|N| computed in
+   *         double, and 1e38 where x^|N| is below 1e-38 (x = 0 included)
+   */
+  template <int N>
+  inline float
+  pow(float x)
+  {
+    static_assert(N > -65536 && N < 65536, "exponent out of range");
+    if constexpr (N < 0)
+    {
+      // In double, so the quotient is not a float division: under
+      // -ffast-math a vectorized one becomes rcpps plus a Newton step,
+      // which is inexact and NaN for 0 and inf. GCC narrows 1.0 / (double)x
+      // back to float, so N = -1 divides x by the exact x * x instead.
+      const double wide = x;
+      const double power = detail::power_by_squaring<-N>(wide);
+      double inverse;
+      if constexpr (N == -1)
+      {
+        inverse = wide / (wide * wide);
+      }
+      else
+      {
+        inverse = 1.0 / power;
+      }
+      return static_cast<float>((std::abs(power) < 1e-38) ? 1e38 : inverse);
+    }
+    else
+    {
+      return detail::power_by_squaring<N>(x);
+    }
+  }
+
+  /**
+   * @brief x^exponent for an exponent that is fixed at run time
+   * @note The constructor picks one of:
+   *       - 0 or 1: constant or copy
+   *       - integer, |n| <= 32: repeated squaring (batch: the pow<N> kernel)
+   *       - n + 0.5, |n + 0.5| < 16: sqrt(x)^(2n + 1), or
+   *         rsqrt(x)^(-2n - 1) for negative exponents, e.g. 1.5 or -1.5
+   *       - otherwise: exp2(exponent * log2(x)), e.g. gamma 2.2
+   *
+   *       The exact kinds overflow to inf like pow() does for integer
+   *       exponents; the general kind saturates at 1e38 like exp2().
+   *
+   *       FastMath::PowPlan gamma(2.2f);
+   *       gamma(pixels.data(), pixels.data(), pixels.size());
+   */
+  class PowPlan
+  {
+  public:
+    /**
+     * @param exponent Exponent applied by every call
+     */
+    explicit PowPlan(float exponent);
+
+    /// Exponent the plan was built for
+    float
+    exponent() const
+    {
+      return exponent_;
+    }
+
+    /**
+     * @brief x^exponent
+     */
+    float operator()(float x) const;
+
+    /**
+     * @brief out[i] = in[i]^exponent for i in [0, n), in-place allowed
+     */
+    void operator()(const float *in, float *out, std::size_t n) const;
+
+  private:
+    enum class Kind
+    {
+      One,
+      Identity,
+      Integer,
+      HalfInteger,
+      General
+    };
+
+    float exponent_;
+    Kind kind_;
+    int integer_; ///< n for Integer, |2 * exponent| for HalfInteger
+  };
+
+  // ---------------------------------------------------------------------------
+  // Batch (array) API
+  //
+  // Each overload applies the scalar function of the same name element-wise:
+  // out[i] = f(in[i]) for i in [0, n). The loops live in the library, so a
+  // large transform costs a single call and can be vectorized and unrolled
+  // there. `in` and `out` may be the same pointer (in-place); partially
+  // overlapping ranges are not supported.
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @brief Batch sine
+   * @param in Input angles in radians
+   * @param out Output buffer receiving sin(in[i])
+   * @param n Number of elements
+   */
+  void sin(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch cosine
+   * @param in Input angles in radians
+   * @param out Output buffer receiving cos(in[i])
+   * @param n Number of elements
+   */
+  void cos(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch sine and cosine
+   * @param in Input angles in radians
+   * @param sin_out Output buffer receiving sin(in[i])
+   * @param cos_out Output buffer receiving cos(in[i])
+   * @param n Number of elements
+   * @note sin_out and cos_out must not overlap each other; either may alias in
+   */
+  void sincos(const float *in, float *sin_out, float *cos_out, std::size_t n);
+
+  /**
+   * @brief Batch square root
+   * @param in Input values
+   * @param out Output buffer receiving sqrt(in[i])
+   * @param n Number of elements
+   * @note The AVX2 and AVX-512 kernels compute x * rsqrt(x) with one
+   *       Newton-Raphson step (within 2.6 ulp on AVX2 and 1 ulp on
+   *       AVX-512, and faster than vsqrtps); subnormal inputs give 0 there
+   */
+  void sqrt(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch reciprocal square root
+   * @param in Input values (> 0)
+   * @param out Output buffer receiving rsqrt(in[i])
+   * @param n Number of elements
+   */
+  void rsqrt(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch normalization of 2D vectors
+   * @param x X components
+   * @param y Y components
+   * @param out_x Output buffer receiving x[i] / |(x[i], y[i])|
+   * @param out_y Output buffer receiving y[i] / |(x[i], y[i])|
+   * @param n Number of vectors
+   * @note Scales by rsqrt() of the squared length, without a division.
+   *       Vectors whose squared length is below FLT_MIN (including zero)
+   *       map to (0, 0). Each output may alias the input of the same
+   *       component.
+   */
+  void normalize(const float *x, const float *y, float *out_x, float *out_y, std::size_t n);
+
+  /**
+   * @brief Batch normalization of 3D vectors
+   * @note Same contract as the 2D overload, with a z component
+   */
+  void normalize(const float *x, const float *y, const float *z, float *out_x, float *out_y, float *out_z,
+                 std::size_t n);
+
+  /**
+   * @brief Batch tangent
+   * @param in Input angles in radians
+   * @param out Output buffer receiving tan(in[i])
+   * @param n Number of elements
+   */
+  void tan(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch arc sine
+   * @param in Input values [-1, 1]
+   * @param out Output buffer receiving asin(in[i])
+   * @param n Number of elements
+   */
+  void asin(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch arc cosine
+   * @param in Input values [-1, 1]
+   * @param out Output buffer receiving acos(in[i])
+   * @param n Number of elements
+   */
+  void acos(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch arc tangent
+   * @param in Input values
+   * @param out Output buffer receiving atan(in[i])
+   * @param n Number of elements
+   */
+  void atan(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch arc tangent 2
+   * @param y Y coordinates
+   * @param x X coordinates
+   * @param out Output buffer receiving atan2(y[i], x[i])
+   * @param n Number of elements
+   */
+  void atan2(const float *y, const float *x, float *out, std::size_t n);
+
+  /**
+   * @brief Batch exponential function
+   * @param in Input values
+   * @param out Output buffer receiving exp(in[i])
+   * @param n Number of elements
+   */
+  void exp(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch base-2 exponential
+   * @param in Input values
+   * @param out Output buffer receiving exp2(in[i])
+   * @param n Number of elements
+   */
+  void exp2(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch base-10 exponential
+   * @param in Input values
+   * @param out Output buffer receiving exp10(in[i])
+   * @param n Number of elements
+   */
+  void exp10(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch exp(x) - 1
+   * @param in Input values
+   * @param out Output buffer receiving expm1(in[i])
+   * @param n Number of elements
+   */
+  void expm1(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch natural logarithm
+   * @param in Input values (> 0)
+   * @param out Output buffer receiving log(in[i])
+   * @param n Number of elements
+   */
+  void log(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch base-10 logarithm
+   * @param in Input values (> 0)
+   * @param out Output buffer receiving log10(in[i])
+   * @param n Number of elements
+   */
+  void log10(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch base-2 logarithm
+   * @param in Input values (> 0)
+   * @param out Output buffer receiving log2(in[i])
+   * @param n Number of elements
+   */
+  void log2(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch log(1 + x)
+   * @param in Input values (> -1)
+   * @param out Output buffer receiving log1p(in[i])
+   * @param n Number of elements
+   */
+  void log1p(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch power function
+   * @param base Base values
+   * @param exponent Exponent values
+   * @param out Output buffer receiving pow(base[i], exponent[i])
+   * @param n Number of elements
+   */
+  void pow(const float *base, const float *exponent, float *out, std::size_t n);
+
+  /**
+   * @brief Batch power function with one exponent for every element
+   * @param in Base values
+   * @param out Output buffer receiving pow(in[i], exponent)
+   * @param n Number of elements
+   * @param exponent Exponent, classified once (see PowPlan)
+   */
+  void pow_batch(const float *in, float *out, std::size_t n, float exponent);
+
+  /**
+   * @brief Batch floating-point remainder
+   * @param dividend Dividend values
+   * @param divisor Divisor values
+   * @param out Output buffer receiving fmod(dividend[i], divisor[i])
+   * @param n Number of elements
+   */
+  void fmod(const float *dividend, const float *divisor, float *out, std::size_t n);
+
+  /**
+   * @brief Batch floating-point remainder with one divisor for every element
+   * @param in Dividend values
+   * @param out Output buffer receiving fmod(in[i], divisor), exact over the
+   *            whole float range
+   * @param n Number of elements
+   * @param divisor Divisor; 0 gives 0 like fmod()
+   * @note The reciprocal is computed once. Quotients below 2^21 take one
+   *       multiply and one exact FMA step; larger ones are reduced exactly
+   *       in a second pass instead of falling back to std::fmod.
+   */
+  void fmod_batch(const float *in, float *out, std::size_t n, float divisor);
+
+  /**
+   * @brief Batch IEEE remainder with one divisor for every element
+   * @param in Dividend values
+   * @param out Output buffer receiving in[i] - k * divisor, k the integer
+   *            nearest to in[i] / divisor (ties to even), so the result lies
+   *            in [-|divisor| / 2, |divisor| / 2]; exact like fmod_batch()
+   * @param n Number of elements
+   * @param divisor Divisor, e.g. the box length for periodic boundaries
+   */
+  void remainder_batch(const float *in, float *out, std::size_t n, float divisor);
+
+  /**
+   * @brief Batch angle wrapping into [-π, π)
+   * @param in Angles in radians
+   * @param out Output buffer receiving wrap_angle(in[i])
+   * @param n Number of elements
+   */
+  void wrap_angle(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch ceiling function
+   * @param in Input values
+   * @param out Output buffer receiving ceil(in[i])
+   * @param n Number of elements
+   */
+  void ceil(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch floor function
+   * @param in Input values
+   * @param out Output buffer receiving floor(in[i])
+   * @param n Number of elements
+   */
+  void floor(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch round function
+   * @param in Input values
+   * @param out Output buffer receiving round(in[i])
+   * @param n Number of elements
+   */
+  void round(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch hyperbolic sine
+   * @param in Input values
+   * @param out Output buffer receiving sinh(in[i])
+   * @param n Number of elements
+   */
+  void sinh(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch hyperbolic cosine
+   * @param in Input values
+   * @param out Output buffer receiving cosh(in[i])
+   * @param n Number of elements
+   */
+  void cosh(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch hyperbolic tangent
+   * @param in Input values
+   * @param out Output buffer receiving tanh(in[i])
+   * @param n Number of elements
+   */
+  void tanh(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch inverse hyperbolic sine
+   * @param in Input values
+   * @param out Output buffer receiving asinh(in[i])
+   * @param n Number of elements
+   */
+  void asinh(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch inverse hyperbolic cosine
+   * @param in Input values (>= 1)
+   * @param out Output buffer receiving acosh(in[i])
+   * @param n Number of elements
+   */
+  void acosh(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Batch inverse hyperbolic tangent
+   * @param in Input values (-1 < x < 1)
+   * @param out Output buffer receiving atanh(in[i])
+   * @param n Number of elements
+   */
+  void atanh(const float *in, float *out, std::size_t n);
+
+  /**
+   * @brief Instruction set tiers available to the batch API
+   */
+  enum class Isa
+  {
+    Generic, ///< Portable compiled loops (SSE2 on x86-64)
+    AVX2,    ///< AVX2 + FMA, 8 lanes
+    AVX512   ///< AVX-512F, 16 lanes
+  };
+
+  /**
+   * @brief Instruction set tier used by the batch API
+   * @return Best tier supported by both the running CPU and this build
+   * @note Detected with CPUID once, on the first batch call. The environment
+   *       variable FAST_MATH_ISA=generic|avx2|avx512 caps the tier.
+   */
+  Isa active_isa();
+
+#ifdef FAST_MATH_HAS_SPAN
+  // std::span adapters (C++20). The element count is the smaller of the
+  // input and output extents.
+  namespace detail
+  {
+    inline std::size_t
+    batch_size(std::size_t a, std::size_t b)
+    {
+      return a < b ? a : b;
+    }
+  } // namespace detail
+
+#define FAST_MATH_SPAN_UNARY(name)                                            \
+  inline void name(std::span<const float> in, std::span<float> out)           \
+  {                                                                           \
+    name(in.data(), out.data(), detail::batch_size(in.size(), out.size()));   \
+  }
+
+#define FAST_MATH_SPAN_BINARY(name)                                           \
+  inline void name(std::span<const float> a, std::span<const float> b,        \
+                   std::span<float> out)                                      \
+  {                                                                           \
+    name(a.data(), b.data(), out.data(),                                      \
+         detail::batch_size(detail::batch_size(a.size(), b.size()), out.size())); \
+  }
+
+  FAST_MATH_SPAN_UNARY(sin)
+  FAST_MATH_SPAN_UNARY(cos)
+  FAST_MATH_SPAN_UNARY(sqrt)
+  FAST_MATH_SPAN_UNARY(rsqrt)
+  FAST_MATH_SPAN_UNARY(tan)
+  FAST_MATH_SPAN_UNARY(asin)
+  FAST_MATH_SPAN_UNARY(acos)
+  FAST_MATH_SPAN_UNARY(atan)
+  FAST_MATH_SPAN_UNARY(wrap_angle)
+  FAST_MATH_SPAN_UNARY(exp)
+  FAST_MATH_SPAN_UNARY(exp2)
+  FAST_MATH_SPAN_UNARY(exp10)
+  FAST_MATH_SPAN_UNARY(expm1)
+  FAST_MATH_SPAN_UNARY(log)
+  FAST_MATH_SPAN_UNARY(log10)
+  FAST_MATH_SPAN_UNARY(log2)
+  FAST_MATH_SPAN_UNARY(log1p)
+  FAST_MATH_SPAN_UNARY(ceil)
+  FAST_MATH_SPAN_UNARY(floor)
+  FAST_MATH_SPAN_UNARY(round)
+  FAST_MATH_SPAN_UNARY(sinh)
+  FAST_MATH_SPAN_UNARY(cosh)
+  FAST_MATH_SPAN_UNARY(tanh)
+  FAST_MATH_SPAN_UNARY(asinh)
+  FAST_MATH_SPAN_UNARY(acosh)
+  FAST_MATH_SPAN_UNARY(atanh)
+  FAST_MATH_SPAN_BINARY(atan2)
+  FAST_MATH_SPAN_BINARY(pow)
+  FAST_MATH_SPAN_BINARY(fmod)
+
+  inline void
+  sincos(std::span<const float> in, std::span<float> sin_out, std::span<float> cos_out)
+  {
+    sincos(in.data(), sin_out.data(), cos_out.data(),
+           detail::batch_size(detail::batch_size(in.size(), sin_out.size()), cos_out.size()));
+  }
+
+#undef FAST_MATH_SPAN_UNARY
+#undef FAST_MATH_SPAN_BINARY
+#endif // FAST_MATH_HAS_SPAN
+
+} // namespace FastMath
+
+#ifdef FAST_MATH_HEADER_ONLY
+#include "fast_math_impl.hpp"
+#endif
@@ -0,0 +1,228 @@
+/**
+ * @file fast_math_execution.hpp
+ * @brief FastMath functions as function objects, and execution-policy
+ *        transforms that route contiguous float arrays to the batch kernels
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * FastMath::sin names an overload set, so it cannot be passed to an
+ * algorithm without picking a function pointer, which the compiler then has
+ * to call indirectly. FastMath::fn::sin is a stateless object whose call is
+ * resolved at compile time, so it inlines into std::transform (including
+ * with std::execution::par_unseq) when the definitions are visible
+ * (header-only target), and otherwise still reaches the vector-ABI
+ * variants:
+ *
+ *   std::transform(std::execution::par_unseq, x.begin(), x.end(), y.begin(), FastMath::fn::sin);
+ *
+ * FastMath::transform takes the same arguments and, when both ranges are
+ * contiguous floats, calls the batch API instead (on parallel::default_pool()
+ * for the parallel policies); any other range falls back to std::transform.
+ *
+ *   FastMath::transform(std::execution::par, x.begin(), x.end(), y.begin(), FastMath::fn::sin);
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<execution>)
+#include <execution>
+#endif
+
+#include "fast_math.hpp"
+#include "fast_math_parallel.hpp"
+
+namespace FastMath
+{
+  /**
+   * @brief Every scalar function as a function object
+   * @note Each object also has the batch signature of its FastMath::op
+   *       counterpart, so it can be passed to parallel::transform as well.
+   */
+  namespace fn
+  {
+#define FAST_MATH_FN_UNARY(name)                                                                                       \
+  struct name##_fn                                                                                                     \
+  {                                                                                                                    \
+    float                                                                                                              \
+    operator()(float x) const                                                                                          \
+    {                                                                                                                  \
+      return FastMath::name(x);                                                                                        \
+    }                                                                                                                  \
+    void                                                                                                               \
+    operator()(const float *in, float *out, std::size_t n) const                                                       \
+    {                                                                                                                  \
+      FastMath::name(in, out, n);                                                                                      \
+    }                                                                                                                  \
+  };                                                                                                                   \
+  inline constexpr name##_fn name{};
+
+#define FAST_MATH_FN_BINARY(name)                                                                                      \
+  struct name##_fn                                                                                                     \
+  {                                                                                                                    \
+    float                                                                                                              \
+    operator()(float a, float b) const                                                                                 \
+    {                                                                                                                  \
+      return FastMath::name(a, b);                                                                                     \
+    }                                                                                                                  \
+    void                                                                                                               \
+    operator()(const float *a, const float *b, float *out, std::size_t n) const                                        \
+    {                                                                                                                  \
+      FastMath::name(a, b, out, n);                                                                                    \
+    }                                                                                                                  \
+  };                                                                                                                   \
+  inline constexpr name##_fn name{};
+
+    FAST_MATH_FN_UNARY(sin)
+    FAST_MATH_FN_UNARY(cos)
+    FAST_MATH_FN_UNARY(sqrt)
+    FAST_MATH_FN_UNARY(rsqrt)
+    FAST_MATH_FN_UNARY(tan)
+    FAST_MATH_FN_UNARY(asin)
+    FAST_MATH_FN_UNARY(acos)
+    FAST_MATH_FN_UNARY(atan)
+    FAST_MATH_FN_UNARY(wrap_angle)
+    FAST_MATH_FN_UNARY(exp)
+    FAST_MATH_FN_UNARY(exp2)
+    FAST_MATH_FN_UNARY(exp10)
+    FAST_MATH_FN_UNARY(expm1)
+    FAST_MATH_FN_UNARY(log)
+    FAST_MATH_FN_UNARY(log10)
+    FAST_MATH_FN_UNARY(log2)
+    FAST_MATH_FN_UNARY(log1p)
+    FAST_MATH_FN_UNARY(ceil)
+    FAST_MATH_FN_UNARY(floor)
+    FAST_MATH_FN_UNARY(round)
+    FAST_MATH_FN_UNARY(sinh)
+    FAST_MATH_FN_UNARY(cosh)
+    FAST_MATH_FN_UNARY(tanh)
+    FAST_MATH_FN_UNARY(asinh)
+    FAST_MATH_FN_UNARY(acosh)
+    FAST_MATH_FN_UNARY(atanh)
+    FAST_MATH_FN_BINARY(atan2)
+    FAST_MATH_FN_BINARY(pow)
+    FAST_MATH_FN_BINARY(fmod)
+
+#undef FAST_MATH_FN_UNARY
+#undef FAST_MATH_FN_BINARY
+  } // namespace fn
+
+#if defined(__cpp_lib_execution)
+  namespace detail
+  {
+    /**
+     * @brief Iterators over contiguous floats of element type T (float or
+     *        const float): pointers and std::vector iterators, plus any
+     *        std::contiguous_iterator in C++20
+     */
+    template <typename It, typename T>
+    constexpr bool is_contiguous_float_iterator =
+        std::is_same_v<It, T *> || std::is_same_v<It, typename std::vector<float>::iterator> ||
+        (std::is_const_v<T> && (std::is_same_v<It, float *> ||
+                                std::is_same_v<It, typename std::vector<float>::const_iterator>))
+#if __cplusplus >= 202002L
+        || (std::contiguous_iterator<It> && std::is_same_v<std::iter_value_t<It>, float> &&
+            (std::is_const_v<T> || !std::is_const_v<std::remove_reference_t<std::iter_reference_t<It>>>))
+#endif
+        ;
+
+    template <typename Policy>
+    constexpr bool is_parallel_policy =
+        std::is_same_v<std::decay_t<Policy>, std::execution::parallel_policy> ||
+        std::is_same_v<std::decay_t<Policy>, std::execution::parallel_unsequenced_policy>;
+
+    /// Address of the element at `it` (only called on non-empty ranges)
+    template <typename It>
+    inline auto
+    element_address(It it)
+    {
+      return std::addressof(*it);
+    }
+  } // namespace detail
+
+  /**
+   * @brief std::transform that runs the batch kernels on contiguous floats
+   * @param function A FastMath::fn object (or anything callable both as
+   *        float(float) and as void(const float *, float *, std::size_t))
+   * @return Iterator past the last element written, as std::transform
+   * @note Sequential policies call the batch function on the calling thread;
+   *       par and par_unseq split it over parallel::default_pool(). Other
+   *       ranges or callables go to std::transform with the same policy.
+   */
+  template <typename Policy, typename InputIt, typename OutputIt, typename Function,
+            typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>>>
+  inline OutputIt
+  transform(Policy &&policy, InputIt first, InputIt last, OutputIt d_first, Function function)
+  {
+    if constexpr (detail::is_contiguous_float_iterator<InputIt, const float> &&
+                  detail::is_contiguous_float_iterator<OutputIt, float> &&
+                  std::is_invocable_v<const Function &, const float *, float *, std::size_t>)
+    {
+      const auto n = std::distance(first, last);
+      if (n > 0)
+      {
+        const float *in = detail::element_address(first);
+        float *out = detail::element_address(d_first);
+        if constexpr (detail::is_parallel_policy<Policy>)
+        {
+          parallel::transform(parallel::default_pool(), in, out, static_cast<std::size_t>(n), function);
+        }
+        else
+        {
+          function(in, out, static_cast<std::size_t>(n));
+        }
+      }
+      return std::next(d_first, n);
+    }
+    else
+    {
+      return std::transform(std::forward<Policy>(policy), first, last, d_first, function);
+    }
+  }
+
+  /**
+   * @brief Two-input std::transform that runs the batch kernels on
+   *        contiguous floats, e.g. with FastMath::fn::atan2
+   */
+  template <typename Policy, typename InputIt1, typename InputIt2, typename OutputIt, typename Function,
+            typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<Policy>>>>
+  inline OutputIt
+  transform(Policy &&policy, InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt d_first, Function function)
+  {
+    if constexpr (detail::is_contiguous_float_iterator<InputIt1, const float> &&
+                  detail::is_contiguous_float_iterator<InputIt2, const float> &&
+                  detail::is_contiguous_float_iterator<OutputIt, float> &&
+                  std::is_invocable_v<const Function &, const float *, const float *, float *, std::size_t>)
+    {
+      const auto n = std::distance(first1, last1);
+      if (n > 0)
+      {
+        const float *a = detail::element_address(first1);
+        const float *b = detail::element_address(first2);
+        float *out = detail::element_address(d_first);
+        if constexpr (detail::is_parallel_policy<Policy>)
+        {
+          parallel::transform(parallel::default_pool(), a, b, out, static_cast<std::size_t>(n), function);
+        }
+        else
+        {
+          function(a, b, out, static_cast<std::size_t>(n));
+        }
+      }
+      return std::next(d_first, n);
+    }
+    else
+    {
+      return std::transform(std::forward<Policy>(policy), first1, last1, first2, d_first, function);
+    }
+  }
+#endif // __cpp_lib_execution
+} // namespace FastMath
@@ -0,0 +1,441 @@
+/**
+ * @file fast_math_expr.hpp
+ * @brief Lazy array expressions evaluated in one fused pass
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Chaining batch calls (exp over x into a temporary, multiply it into
+ * another, ...) streams every intermediate array through memory. With
+ * FastMath::expr the same formula only builds a small expression object:
+ *
+ *   using namespace FastMath::expr;
+ *   const auto x = view(xs);
+ *   evaluate(exp(-0.5f * x * x / s2) * k, out.data());
+ *   evaluate(atan2(view(ys), x) - heading, out.data());
+ *
+ * evaluate() then walks the arrays once, in tiles of expr::tile elements
+ * that stay in L1: each node computes its tile into a stack buffer,
+ * functions run the batch kernels of the FastMath API in place on the tile,
+ * and arithmetic runs as plain loops the compiler vectorizes. Inputs are read and the output is written once,
+ * whatever the number of operations, and nothing is allocated.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "fast_math.hpp"
+#include "fast_math_execution.hpp"
+#include "fast_math_parallel.hpp"
+
+namespace FastMath
+{
+  namespace expr
+  {
+    /**
+     * @brief Elements per tile
+     * @note 2 KiB per intermediate: a few nested operations still fit in L1,
+     *       and the per-call overhead of each batch kernel is amortized over
+     *       32 AVX-512 or 64 AVX2 vectors.
+     */
+    constexpr std::size_t tile = 512;
+
+    /**
+     * @brief Leaf reading an existing array
+     */
+    class View
+    {
+    public:
+      using expression_tag = void;
+
+      View(const float *data, std::size_t size) : data_(data), size_(size)
+      {
+      }
+
+      std::size_t
+      size() const
+      {
+        return size_;
+      }
+
+      /// Elements [offset, offset + count); needs no buffer
+      const float *
+      get(std::size_t offset, std::size_t, float *) const
+      {
+        return data_ + offset;
+      }
+
+    private:
+      const float *data_;
+      std::size_t size_;
+    };
+
+    /**
+     * @brief Constant operand; arithmetic reads the value directly, only
+     *        function arguments (e.g. pow(x, 2.5f)) broadcast it to a tile
+     */
+    struct Scalar
+    {
+      using expression_tag = void;
+
+      float value;
+
+      std::size_t
+      size() const
+      {
+        return std::numeric_limits<std::size_t>::max();
+      }
+
+      const float *
+      get(std::size_t, std::size_t count, float *buffer) const
+      {
+        std::fill(buffer, buffer + count, value);
+        return buffer;
+      }
+    };
+
+    namespace detail
+    {
+      template <typename T, typename = void>
+      struct is_expression : std::false_type
+      {
+      };
+
+      template <typename T>
+      struct is_expression<T, std::void_t<typename T::expression_tag>> : std::true_type
+      {
+      };
+
+      template <typename T>
+      constexpr bool is_expression_v = is_expression<std::decay_t<T>>::value;
+
+      /// Floats become Scalar, expressions stay as they are
+      template <typename T>
+      inline auto
+      operand(const T &value)
+      {
+        if constexpr (is_expression_v<T>)
+        {
+          return value;
+        }
+        else
+        {
+          return Scalar{static_cast<float>(value)};
+        }
+      }
+
+      template <typename L, typename R>
+      using enable_operator =
+          std::enable_if_t<(is_expression_v<L> || is_expression_v<R>) &&
+                           (is_expression_v<L> || std::is_arithmetic_v<L>) &&
+                           (is_expression_v<R> || std::is_arithmetic_v<R>)>;
+
+      struct Add
+      {
+        static float
+        apply(float a, float b)
+        {
+          return a + b;
+        }
+      };
+
+      struct Subtract
+      {
+        static float
+        apply(float a, float b)
+        {
+          return a - b;
+        }
+      };
+
+      struct Multiply
+      {
+        static float
+        apply(float a, float b)
+        {
+          return a * b;
+        }
+      };
+
+      struct Divide
+      {
+        static float
+        apply(float a, float b)
+        {
+          return a / b;
+        }
+      };
+    } // namespace detail
+
+    /**
+     * @brief Element-wise arithmetic, with either side possibly a Scalar
+     */
+    template <typename Op, typename L, typename R>
+    class Arithmetic
+    {
+    public:
+      using expression_tag = void;
+
+      Arithmetic(const L &left, const R &right) : left_(left), right_(right)
+      {
+      }
+
+      std::size_t
+      size() const
+      {
+        return std::min(left_.size(), right_.size());
+      }
+
+      /// Result in `buffer` (which holds at least `count` elements)
+      const float *
+      get(std::size_t offset, std::size_t count, float *buffer) const
+      {
+        if constexpr (std::is_same_v<L, Scalar>)
+        {
+          const float a = left_.value;
+          const float *b = right_.get(offset, count, buffer);
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            buffer[i] = Op::apply(a, b[i]);
+          }
+        }
+        else if constexpr (std::is_same_v<R, Scalar>)
+        {
+          const float *a = left_.get(offset, count, buffer);
+          const float b = right_.value;
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            buffer[i] = Op::apply(a[i], b);
+          }
+        }
+        else
+        {
+          float scratch[tile];
+          const float *a = left_.get(offset, count, buffer);
+          const float *b = right_.get(offset, count, scratch);
+          for (std::size_t i = 0; i < count; ++i)
+          {
+            buffer[i] = Op::apply(a[i], b[i]);
+          }
+        }
+        return buffer;
+      }
+
+    private:
+      L left_;
+      R right_;
+    };
+
+    /**
+     * @brief Batch function of one argument, e.g. fn::exp
+     */
+    template <typename Function, typename E>
+    class Call
+    {
+    public:
+      using expression_tag = void;
+
+      explicit Call(const E &argument) : argument_(argument)
+      {
+      }
+
+      std::size_t
+      size() const
+      {
+        return argument_.size();
+      }
+
+      const float *
+      get(std::size_t offset, std::size_t count, float *buffer) const
+      {
+        Function()(argument_.get(offset, count, buffer), buffer, count);
+        return buffer;
+      }
+
+    private:
+      E argument_;
+    };
+
+    /**
+     * @brief Batch function of two arguments, e.g. fn::atan2
+     */
+    template <typename Function, typename L, typename R>
+    class Call2
+    {
+    public:
+      using expression_tag = void;
+
+      Call2(const L &left, const R &right) : left_(left), right_(right)
+      {
+      }
+
+      std::size_t
+      size() const
+      {
+        return std::min(left_.size(), right_.size());
+      }
+
+      const float *
+      get(std::size_t offset, std::size_t count, float *buffer) const
+      {
+        float scratch[tile];
+        const float *a = left_.get(offset, count, buffer);
+        const float *b = right_.get(offset, count, scratch);
+        Function()(a, b, buffer, count);
+        return buffer;
+      }
+
+    private:
+      L left_;
+      R right_;
+    };
+
+    /// Expression leaf over `size` elements at `data`
+    inline View
+    view(const float *data, std::size_t size)
+    {
+      return View(data, size);
+    }
+
+    inline View
+    view(const std::vector<float> &values)
+    {
+      return View(values.data(), values.size());
+    }
+
+#define FAST_MATH_EXPR_OPERATOR(symbol, op)                                                                            \
+  template <typename L, typename R, typename = detail::enable_operator<L, R>>                                          \
+  inline auto operator symbol(const L &left, const R &right)                                                           \
+  {                                                                                                                    \
+    using Left = decltype(detail::operand(left));                                                                      \
+    using Right = decltype(detail::operand(right));                                                                    \
+    return Arithmetic<detail::op, Left, Right>(detail::operand(left), detail::operand(right));                         \
+  }
+
+    FAST_MATH_EXPR_OPERATOR(+, Add)
+    FAST_MATH_EXPR_OPERATOR(-, Subtract)
+    FAST_MATH_EXPR_OPERATOR(*, Multiply)
+    FAST_MATH_EXPR_OPERATOR(/, Divide)
+
+#undef FAST_MATH_EXPR_OPERATOR
+
+    template <typename E, typename = std::enable_if_t<detail::is_expression_v<E>>>
+    inline auto
+    operator-(const E &argument)
+    {
+      return Arithmetic<detail::Multiply, Scalar, E>(Scalar{-1.0f}, argument);
+    }
+
+#define FAST_MATH_EXPR_UNARY(name)                                                                                     \
+  template <typename E, typename = std::enable_if_t<detail::is_expression_v<E>>>                                       \
+  inline auto name(const E &argument)                                                                                  \
+  {                                                                                                                    \
+    return Call<fn::name##_fn, E>(argument);                                                                           \
+  }
+
+#define FAST_MATH_EXPR_BINARY(name)                                                                                    \
+  template <typename L, typename R, typename = detail::enable_operator<L, R>>                                          \
+  inline auto name(const L &left, const R &right)                                                                      \
+  {                                                                                                                    \
+    using Left = decltype(detail::operand(left));                                                                      \
+    using Right = decltype(detail::operand(right));                                                                    \
+    return Call2<fn::name##_fn, Left, Right>(detail::operand(left), detail::operand(right));                           \
+  }
+
+    FAST_MATH_EXPR_UNARY(sin)
+    FAST_MATH_EXPR_UNARY(cos)
+    FAST_MATH_EXPR_UNARY(sqrt)
+    FAST_MATH_EXPR_UNARY(rsqrt)
+    FAST_MATH_EXPR_UNARY(tan)
+    FAST_MATH_EXPR_UNARY(asin)
+    FAST_MATH_EXPR_UNARY(acos)
+    FAST_MATH_EXPR_UNARY(atan)
+    FAST_MATH_EXPR_UNARY(wrap_angle)
+    FAST_MATH_EXPR_UNARY(exp)
+    FAST_MATH_EXPR_UNARY(exp2)
+    FAST_MATH_EXPR_UNARY(exp10)
+    FAST_MATH_EXPR_UNARY(expm1)
+    FAST_MATH_EXPR_UNARY(log)
+    FAST_MATH_EXPR_UNARY(log10)
+    FAST_MATH_EXPR_UNARY(log2)
+    FAST_MATH_EXPR_UNARY(log1p)
+    FAST_MATH_EXPR_UNARY(ceil)
+    FAST_MATH_EXPR_UNARY(floor)
+    FAST_MATH_EXPR_UNARY(round)
+    FAST_MATH_EXPR_UNARY(sinh)
+    FAST_MATH_EXPR_UNARY(cosh)
+    FAST_MATH_EXPR_UNARY(tanh)
+    FAST_MATH_EXPR_UNARY(asinh)
+    FAST_MATH_EXPR_UNARY(acosh)
+    FAST_MATH_EXPR_UNARY(atanh)
+    FAST_MATH_EXPR_BINARY(atan2)
+    FAST_MATH_EXPR_BINARY(pow)
+    FAST_MATH_EXPR_BINARY(fmod)
+
+#undef FAST_MATH_EXPR_UNARY
+#undef FAST_MATH_EXPR_BINARY
+
+    namespace detail
+    {
+      /**
+       * @brief Tiles of [begin, end), each computed in a stack buffer and
+       *        then copied to `out`
+       * @note Not computed in `out` directly: Arithmetic and Call2 write
+       *       their left operand into the buffer before reading the right
+       *       one, which would clobber an input aliasing `out`. The copy
+       *       stays in L1.
+       */
+      template <typename E>
+      inline void
+      evaluate_range(const E &expression, float *out, std::size_t begin, std::size_t end)
+      {
+        float buffer[tile];
+        for (std::size_t offset = begin; offset < end; offset += tile)
+        {
+          const std::size_t count = std::min(tile, end - offset);
+          const float *result = expression.get(offset, count, buffer);
+          if (result != out + offset)
+          {
+            std::memmove(out + offset, result, count * sizeof(float));
+          }
+        }
+      }
+    } // namespace detail
+
+    /**
+     * @brief Write the expression's size() elements to `out`
+     * @note The size is the smallest extent of the views involved. `out`
+     *       may be one of the inputs, as long as that view starts at `out`
+     *       itself and not at an offset from it: each tile is complete
+     *       before it is written back.
+     */
+    template <typename E, typename = std::enable_if_t<detail::is_expression_v<E>>>
+    inline void
+    evaluate(const E &expression, float *out)
+    {
+      detail::evaluate_range(expression, out, 0, expression.size());
+    }
+
+    /**
+     * @brief evaluate() split into chunks over a thread pool
+     */
+    template <typename E, typename = std::enable_if_t<detail::is_expression_v<E>>>
+    inline void
+    evaluate(parallel::ThreadPool &pool, const E &expression, float *out,
+             std::size_t chunk = parallel::default_chunk)
+    {
+      const std::size_t n = expression.size();
+      chunk = std::max<std::size_t>(chunk, 1);
+      pool.run((n + chunk - 1) / chunk, [&, chunk](std::size_t task) {
+        const std::size_t begin = task * chunk;
+        detail::evaluate_range(expression, out, begin, std::min(n, begin + chunk));
+      });
+    }
+  } // namespace expr
+} // namespace FastMath
@@ -0,0 +1,1990 @@
+/**
+ * @file fast_math_impl.hpp
+ * @brief Definitions of the scalar fast math functions
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Included by src/fast_math.cpp for the compiled library, or by
+ * fast_math.hpp itself when FAST_MATH_HEADER_ONLY is defined, in which case
+ * every function is emitted inline so it can be inlined and auto-vectorized
+ * in user code. Do not include this file directly.
+ */
+
+#pragma once
+
+#include "fast_math.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "fast_math_profile.hpp"
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+// Keeps -ffast-math from reassociating split-constant (Cody–Waite) sums
+// back into a single, less precise operation
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_assoc_barrier)
+#define FAST_MATH_ASSOC_BARRIER(x) __builtin_assoc_barrier(x)
+#endif
+#endif
+#ifndef FAST_MATH_ASSOC_BARRIER
+#define FAST_MATH_ASSOC_BARRIER(x) (x)
+#endif
+
+namespace FastMath
+{
+  namespace detail
+  {
+    /**
+     * @brief Bits of 1/(2π) after the binary point, preceded by one zero word
+     * @note Word 0 stands for the (zero) integer part so that the bit window
+     *       used by reduce_two_pi_large() never starts before the table
+     */
+    constexpr std::uint32_t inv_two_pi_bits[] = {
+        0x00000000, 0x28BE60DB, 0x9391054A, 0x7F09D5F4,
+        0x7D4D3770, 0x36D8A566, 0x4F10E410, 0x7F9458EA};
+
+    /**
+     * @brief Payne–Hanek reduction of theta into [-π, π)
+     * @param theta Any finite input
+     * @return theta - k * 2π for the nearest integer k, exact to float precision
+     * @note theta = m * 2^e with a 24-bit integer m, so frac(theta / 2π) only
+     *       depends on the 96 bits of 1/(2π) starting at bit e + 1; the
+     *       integer part of the product is dropped by working modulo 2^96.
+     *       Uses 32-bit limbs only so that it also builds on 32-bit ARM.
+     */
+    inline float
+    reduce_two_pi_large(float theta)
+    {
+      std::uint32_t bits;
+      std::memcpy(&bits, &theta, sizeof(bits));
+      const int exponent = static_cast<int>((bits >> 23) & 0xFF) - 150;
+      const std::uint64_t mantissa = (bits & 0x7FFFFF) | 0x800000;
+
+      // Callers only get here for |theta| > 2^30, i.e. exponent > 6
+      const int start = exponent + 32;
+      const int word = start >> 5;
+      const int shift = start & 31;
+      std::uint32_t window[3];
+      for (int i = 0; i < 3; ++i)
+      {
+        const std::uint64_t pair = (static_cast<std::uint64_t>(inv_two_pi_bits[word + i]) << 32) |
+                                   inv_two_pi_bits[word + i + 1];
+        window[i] = static_cast<std::uint32_t>(pair >> (32 - shift));
+      }
+
+      // Low 96 bits of mantissa * window, most significant limb first
+      std::uint64_t product = mantissa * window[2];
+      product = mantissa * window[1] + (product >> 32);
+      const std::uint32_t middle = static_cast<std::uint32_t>(product);
+      product = mantissa * window[0] + (product >> 32);
+      const std::uint64_t fraction = (product << 32) | middle;
+
+      // Read as signed, the 64-bit fraction is already wrapped into [-0.5, 0.5)
+      constexpr double two_pi_over_two_64 = 6.283185307179586476925 / 18446744073709551616.0;
+      const float reduced = static_cast<float>(static_cast<double>(static_cast<std::int64_t>(fraction)) *
+                                               two_pi_over_two_64);
+      return (bits >> 31) ? -reduced : reduced;
+    }
+
+    /**
+     * @brief t rounded to the nearest integer, halfway cases away from zero
+     * @param t Any double; clamped to ±2^52, beyond which no reduction in
+     *       double is meaningful anyway
+     * @param parity Set to the lowest bit of the result
+     * @note Converts a multiple of 2^26 and the remainder separately so
+     *       that neither int conversion can overflow. Unlike std::rint
+     *       without SSE4.1, int conversions vectorize on every target, and
+     *       the code is straight-line for the vector clones of sin/cos.
+     */
+    inline double
+    round_to_integer(double t, int &parity)
+    {
+      const double clamped = std::min(0x1p52, std::max(-0x1p52, t));
+      const double high = static_cast<double>(static_cast<int>(clamped * 0x1p-26)) * 0x1p26;
+      const double rest = clamped - high;
+      const int low = static_cast<int>(rest + (rest >= 0.0 ? 0.5 : -0.5));
+      parity = low & 1;
+      return high + static_cast<double>(low);
+    }
+
+    /**
+     * @brief Reduce theta into [-π, π] in constant time
+     * @param theta Input angle in radians
+     * @return theta - k * 2π with k = round(theta / 2π)
+     * @note Cody–Waite reduction carried out in double: two_pi_hi has 22
+     *       significant bits, so k * two_pi_hi is exact for |k| < 2^31 and
+     *       the reduced angle keeps full float precision for |theta| up to
+     *       about 1e9. Working in double keeps float accuracy even where a
+     *       compiler without __builtin_assoc_barrier folds the two products
+     *       back together under -ffast-math. The code is straight-line, so
+     *       the vector clones of sin/cos stay vectorized. Beyond 1e9 the
+     *       error grows as |theta| * 2^-53 and the result is only clamped
+     *       into [-π, π]; defining FAST_MATH_PAYNE_HANEK routes
+     *       |theta| > 2^30 through reduce_two_pi_large() at the cost of one
+     *       well-predicted branch.
+     */
+    inline float
+    reduce_two_pi(float theta)
+    {
+      constexpr double pi = 3.14159265358979323846;
+      constexpr double inv_two_pi = 0.159154943091895335768883763372514362;
+      constexpr double two_pi_hi = 6.283185958862305;
+      constexpr double two_pi_lo = -6.516827182105748e-07;
+
+#ifdef FAST_MATH_PAYNE_HANEK
+      if (std::abs(theta) > 1073741824.0f)
+      {
+        return reduce_two_pi_large(theta);
+      }
+#endif
+      const double x = theta;
+      int parity;
+      const double k = round_to_integer(x * inv_two_pi, parity);
+      const double r = FAST_MATH_ASSOC_BARRIER(x - k * two_pi_hi) - k * two_pi_lo;
+      return static_cast<float>(std::min(pi, std::max(-pi, r)));
+    }
+
+    /**
+     * @brief Parabola y = B*θ - C*θ*|θ| through sin's zeros and extrema,
+     *        for theta in [-π, π]
+     * @note Written without branches on the sign of theta so that the
+     *       declare-simd clones of sin/cos vectorize
+     */
+    inline float
+    sin_parabola(float theta)
+    {
+      constexpr float pi = 3.14159265358979323846264338327950288;
+      constexpr float B = float(4.0) / pi;
+      constexpr float C = float(4.0) / (pi * pi);
+
+      return theta * B - C * theta * std::abs(theta);
+    }
+
+    /**
+     * @brief Parabolic sine with the weighted P = 0.225 correction, for
+     *        theta in [-π, π]
+     */
+    inline float
+    sin_reduced(float theta)
+    {
+      constexpr float P = float(0.225);
+
+      const float y = sin_parabola(theta);
+      return P * (y * std::abs(y) - y) + y;
+    }
+
+    /**
+     * @brief theta + π/2 wrapped back into [-π, π], for theta in [-π, π]
+     */
+    inline float
+    quarter_turn(float theta)
+    {
+      constexpr float pi = 3.14159265358979323846264338327950288;
+      constexpr float half_pi = pi / float(2.0);
+      constexpr float two_pi = float(2.0) * pi;
+
+      theta += half_pi;
+      return theta > pi ? theta - two_pi : theta;
+    }
+
+    /**
+     * @brief cos(θ) = sin(θ + π/2) for theta in [-π, π]
+     */
+    inline float
+    cos_reduced(float theta)
+    {
+      return sin_reduced(quarter_turn(theta));
+    }
+
+    /**
+     * @brief Reduce theta to r in [-π/2, π/2] with theta = (k + phase) * π + r
+     * @param theta Input angle in radians
+     * @param phase 0 for sine, 0.5 for cosine
+     * @param odd Set to whether k is odd
+     * @return r, accurate to float precision
+     * @note Cody–Waite in double as in reduce_two_pi(), with a 22-bit pi_hi
+     *       so that (k + phase) * pi_hi stays exact, and the same clamp
+     *       beyond its range. Only the parity of k is kept. Then
+     *       sin(theta) = (-1)^k sin(r) and, for phase 0.5,
+     *       cos(theta) = -(-1)^k sin(r).
+     */
+    inline float
+    reduce_pi(float theta, double phase, bool &odd)
+    {
+      constexpr double half_pi = 1.57079632679489661923;
+      constexpr double inv_pi = 0.318309886183790671537767526745028724;
+      constexpr double pi_hi = 3.1415929794311523;
+      constexpr double pi_lo = -3.258413591052874e-07;
+
+#ifdef FAST_MATH_PAYNE_HANEK
+      if (std::abs(theta) > 1073741824.0f)
+      {
+        theta = reduce_two_pi_large(theta);
+      }
+#endif
+      const double x = theta;
+      int parity;
+      const double shift = round_to_integer(x * inv_pi - phase, parity) + phase;
+      odd = parity != 0;
+      const double r = FAST_MATH_ASSOC_BARRIER(x - shift * pi_hi) - shift * pi_lo;
+      return static_cast<float>(std::min(half_pi, std::max(-half_pi, r)));
+    }
+
+    /**
+     * @brief Degree-11 odd minimax polynomial for sin on [-π/2, π/2]
+     * @note Chebyshev fit of (sin(r) - r) / r³ in r², error below 1.1e-10
+     */
+    inline float
+    sin_minimax(float r)
+    {
+      const float z = r * r;
+      float p = -2.408019043e-08f;
+      p = p * z + 2.753646356e-06f;
+      p = p * z - 1.984108656e-04f;
+      p = p * z + 8.333332769e-03f;
+      p = p * z - 1.666666666e-01f;
+      return r + r * z * p;
+    }
+  } // namespace detail
+
+  /**
+   * sinをy=a+bx+cx^2の形で近似する
+   * sin(0) = 0, sin(π/2) = 1, sin(π) = 0より
+   * a = 0, b = 4 / π, c = -4 / (π^2)となる
+   * さらに精度を向上させるために、加重平均を用いる
+   * Q * y + P * y * abs(y)としたとき、
+   * 絶対誤差が最も小さいのは、Q = 0.775, P = 0.225となる
+   * 相対誤差が最も小さいのは、Q = 0.782, P = 0.218となる
+   * 今回は絶対誤差が最も小さい組み合わせを採用する
+   * これにより計算速度が向上する
+   */
+  template <Precision P>
+  FAST_MATH_INLINE float
+  sin(float theta)
+  {
+    FAST_MATH_PROFILE_CALL(Sin, theta);
+    FAST_MATH_PROFILE_PATH(SinLargeArgument, std::abs(theta) > 0x1p30f);
+    if constexpr (P == Precision::High)
+    {
+      bool odd;
+      const float s = detail::sin_minimax(detail::reduce_pi(theta, 0.0, odd));
+      return odd ? -s : s;
+    }
+    else if constexpr (P == Precision::Medium)
+    {
+      return detail::sin_reduced(detail::reduce_two_pi(theta));
+    }
+    else
+    {
+      return detail::sin_parabola(detail::reduce_two_pi(theta));
+    }
+  }
+
+  template <Precision P>
+  FAST_MATH_INLINE float
+  cos(float theta)
+  {
+    FAST_MATH_PROFILE_CALL(Cos, theta);
+    FAST_MATH_PROFILE_PATH(CosLargeArgument, std::abs(theta) > 0x1p30f);
+    if constexpr (P == Precision::High)
+    {
+      bool odd;
+      const float s = detail::sin_minimax(detail::reduce_pi(theta, 0.5, odd));
+      return odd ? s : -s;
+    }
+    else if constexpr (P == Precision::Medium)
+    {
+      return detail::cos_reduced(detail::reduce_two_pi(theta));
+    }
+    else
+    {
+      return detail::sin_parabola(detail::quarter_turn(detail::reduce_two_pi(theta)));
+    }
+  }
+
+  FAST_MATH_INLINE float
+  sin(float theta)
+  {
+    return sin<Precision::Medium>(theta);
+  }
+
+  FAST_MATH_INLINE float
+  cos(float theta)
+  {
+    return cos<Precision::Medium>(theta);
+  }
+
+  FAST_MATH_INLINE void
+  sincos(float theta, float *sin_out, float *cos_out)
+  {
+    FAST_MATH_PROFILE_CALL(Sincos, theta);
+    FAST_MATH_PROFILE_PATH(SincosLargeArgument, std::abs(theta) > 0x1p30f);
+    const float reduced = detail::reduce_two_pi(theta);
+    *sin_out = detail::sin_reduced(reduced);
+    *cos_out = detail::cos_reduced(reduced);
+  }
+
+  /**
+   * @brief Square root
+   * @param number Input number
+   * @return Square root of the input number, 0 for number <= 0
+   * @note std::sqrt compiles to one correctly rounded instruction (sqrtss,
+   *       fsqrt), which a bit-trick guess plus Newton-Raphson divisions
+   *       cannot beat
+   */
+  FAST_MATH_INLINE float
+  sqrt(float number)
+  {
+    FAST_MATH_PROFILE_CALL(Sqrt, number);
+    if (number <= 0.0f)
+      return FAST_MATH_PROFILE_TAKEN(SqrtNonPositive, 0.0f);
+
+    return std::sqrt(number);
+  }
+
+  /**
+   * @brief Fast reciprocal square root
+   * @param number Input number
+   * @return 1 / sqrt(number), 1e38 for number <= 0 or subnormal
+   * @note Newton-Raphson for 1/sqrt needs no division:
+   *       y' = y + y/2 * (1 - x*y*y). x*y is formed first so that x*y*y
+   *       stays in range for every normal x.
+   */
+  FAST_MATH_INLINE float
+  rsqrt(float number)
+  {
+    FAST_MATH_PROFILE_CALL(Rsqrt, number);
+    if (number < 1.17549435e-38f) // FLT_MIN
+      return FAST_MATH_PROFILE_TAKEN(RsqrtTiny, 1e38f);
+
+#if defined(__SSE__)
+    // 12-bit hardware estimate; one step brings it to ~23 bits
+    float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(number)));
+    y = y + 0.5f * y * (1.0f - FAST_MATH_ASSOC_BARRIER(number * y) * y);
+#else
+    // 0x5F375A86 guess (relative error 1.8e-3), two steps
+    std::uint32_t bits;
+    std::memcpy(&bits, &number, sizeof(bits));
+    bits = 0x5F375A86u - (bits >> 1);
+    float y;
+    std::memcpy(&y, &bits, sizeof(y));
+    y = y + 0.5f * y * (1.0f - FAST_MATH_ASSOC_BARRIER(number * y) * y);
+    y = y + 0.5f * y * (1.0f - FAST_MATH_ASSOC_BARRIER(number * y) * y);
+#endif
+    return y;
+  }
+
+  /**
+   * @brief Fast tangent
+   * @param angle Angle in radians
+   * @return Tangent value
+   * @note Uses sin/cos ratio for accuracy
+   */
+  FAST_MATH_INLINE float
+  tan(float theta)
+  {
+    FAST_MATH_PROFILE_CALL(Tan, theta);
+    FAST_MATH_PROFILE_PATH(TanLargeArgument, std::abs(theta) > 0x1p30f);
+    float sin_val;
+    float cos_val;
+    sincos(theta, &sin_val, &cos_val);
+
+    // Avoid division by zero
+    if (std::abs(cos_val) < 1e-7f)
+    {
+      return FAST_MATH_PROFILE_TAKEN(TanPole, (cos_val >= 0.0f) ? 1e7f : -1e7f);
+    }
+
+    return sin_val / cos_val;
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief asin(s) for s in [0, 0.5] from the reduced argument z = s²
+     * @note Cephes asinf minimax polynomial, asin(s) ≈ s + s * z * P(z),
+     *       accurate to about 1 ulp
+     */
+    inline float
+    asin_kernel(float s, float z)
+    {
+      float p = 4.2163199048e-2f;
+      p = p * z + 2.4181311049e-2f;
+      p = p * z + 4.5470025998e-2f;
+      p = p * z + 7.4953002686e-2f;
+      p = p * z + 1.6666752422e-1f;
+      return s + s * z * p;
+    }
+  } // namespace detail
+
+  /**
+   * @brief Fast arc sine using a minimax polynomial
+   * @param x Input value [-1, 1]
+   * @return Arc sine in radians
+   * @note |x| <= 0.5 evaluates the polynomial directly. Closer to ±1 it uses
+   *       asin(a) = π/2 - 2 * asin(sqrt((1 - a) / 2)), which keeps the
+   *       polynomial argument in [0, 0.5]. Inputs outside [-1, 1] are
+   *       clamped. Written with selects so that batch loops vectorize.
+   */
+  FAST_MATH_INLINE float
+  asin(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Asin, x);
+    FAST_MATH_PROFILE_PATH(AsinNearOne, std::abs(x) > 0.5f);
+    FAST_MATH_PROFILE_PATH(AsinOutOfDomain, std::abs(x) > 1.0f);
+    constexpr float half_pi = M_PI / 2.0f;
+
+    const float a = std::min(std::abs(x), 1.0f);
+    const bool near_one = a > 0.5f;
+    const float z = near_one ? 0.5f * (1.0f - a) : a * a;
+    const float s = near_one ? std::sqrt(z) : a;
+    const float p = detail::asin_kernel(s, z);
+    const float result = near_one ? half_pi - 2.0f * p : p;
+    return x < 0.0f ? -result : result;
+  }
+
+  /**
+   * @brief Fast arc cosine using a minimax polynomial
+   * @param x Input value [-1, 1]
+   * @return Arc cosine in radians
+   * @note Shares the reduction of asin(); near ±1 it uses
+   *       acos(x) = 2 * asin(sqrt((1 - x) / 2)) (π minus that for x < 0),
+   *       which avoids the cancellation in π/2 - asin(x)
+   */
+  FAST_MATH_INLINE float
+  acos(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Acos, x);
+    FAST_MATH_PROFILE_PATH(AcosNearOne, std::abs(x) > 0.5f);
+    FAST_MATH_PROFILE_PATH(AcosOutOfDomain, std::abs(x) > 1.0f);
+    constexpr float pi = M_PI;
+    constexpr float half_pi = M_PI / 2.0f;
+
+    const float a = std::min(std::abs(x), 1.0f);
+    const bool near_one = a > 0.5f;
+    const float z = near_one ? 0.5f * (1.0f - a) : a * a;
+    const float s = near_one ? std::sqrt(z) : a;
+    const float p = detail::asin_kernel(s, z);
+    const float positive = near_one ? 2.0f * p : half_pi - p;
+    const float negative = near_one ? pi - 2.0f * p : half_pi + p;
+    return x < 0.0f ? negative : positive;
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief atan(n / d) for 0 <= n <= d, in [0, π/4]
+     * @note Minimax polynomials of the form t + t*z*q(z), z = t², fitted
+     *       for relative error, so tiny ratios come out exact. High folds
+     *       the ratio around tan(π/8), atan(a) = π/4 + atan((a - 1) / (a + 1)),
+     *       with the fold applied to the numerator and denominator so that
+     *       every tier needs exactly one division.
+     */
+    template <Precision P>
+    inline float
+    atan_octant(float n, float d)
+    {
+      constexpr float quarter_pi = M_PI / 4.0f;
+      if constexpr (P == Precision::High)
+      {
+        constexpr float tan_pi_8 = 0.414213562373095049f;
+        const bool fold = n > tan_pi_8 * d;
+        const float t = (fold ? n - d : n) / (fold ? n + d : d);
+        const float z = t * t;
+        float q = 8.0537226967e-2f;
+        q = q * z - 1.3877678737e-1f;
+        q = q * z + 1.9977710026e-1f;
+        q = q * z - 3.3332949139e-1f;
+        return (fold ? quarter_pi : 0.0f) + (t + t * z * q);
+      }
+      else if constexpr (P == Precision::Medium)
+      {
+        const float t = n / d;
+        const float z = t * t;
+        float q = -1.3955098904e-2f;
+        q = q * z + 5.8770250113e-2f;
+        q = q * z - 1.2251500929e-1f;
+        q = q * z + 1.9618309286e-1f;
+        q = q * z - 3.3308900025e-1f;
+        return t + t * z * q;
+      }
+      else
+      {
+        // atan(a) ≈ a * (π/4 + 0.273 * (1 - a))
+        const float t = n / d;
+        return t * (quarter_pi + 0.273f * (1.0f - t));
+      }
+    }
+  } // namespace detail
+
+  /**
+   * @brief Arc tangent
+   * @param x Input value
+   * @return Arc tangent in radians [-π/2, π/2]
+   * @note |x| > 1 uses atan(|x|) = π/2 - atan(1/|x|); both cases go
+   *       through the same division 1/|x| or |x|/1, with selects only
+   */
+  template <Precision P>
+  FAST_MATH_INLINE float
+  atan(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Atan, x);
+    FAST_MATH_PROFILE_PATH(AtanReciprocal, std::abs(x) > 1.0f);
+    constexpr float half_pi = M_PI / 2.0f;
+
+    const float a = std::abs(x);
+    const bool swap = a > 1.0f;
+    float angle = detail::atan_octant<P>(swap ? 1.0f : a, swap ? a : 1.0f);
+    angle = swap ? half_pi - angle : angle;
+    return (x < 0.0f) ? -angle : angle;
+  }
+
+  /**
+   * @brief Arc tangent 2 (atan2)
+   * @param y Y coordinate
+   * @param x X coordinate
+   * @return Arc tangent in radians [-π, π]
+   * @note atan of min(|x|, |y|) / max(|x|, |y|) in [0, π/4], then mirrored
+   *       into the right octant and quadrant. Written with selects instead
+   *       of branches so that the vector-ABI variants can be vectorized.
+   */
+  template <Precision P>
+  FAST_MATH_INLINE float
+  atan2(float y, float x)
+  {
+    FAST_MATH_PROFILE_CALL(Atan2, y);
+    FAST_MATH_PROFILE_PATH(Atan2Swapped, std::abs(y) > std::abs(x));
+    FAST_MATH_PROFILE_PATH(Atan2OnAxis, std::abs(x) < 1e-7f);
+    constexpr float pi = M_PI;
+    constexpr float half_pi = M_PI / 2.0f;
+
+    const float abs_y = std::abs(y);
+    const float abs_x = std::abs(x);
+    const bool swap = abs_y > abs_x;
+    const float d = swap ? abs_y : abs_x;
+    float angle = detail::atan_octant<P>(swap ? abs_x : abs_y, d);
+    angle = swap ? half_pi - angle : angle;
+
+    // Adjust for quadrant
+    angle = (x < 0.0f) ? pi - angle : angle;
+    angle = (y < 0.0f) ? -angle : angle;
+
+    if constexpr (P == Precision::High)
+    {
+      // 0 / 0 is the only ratio that is not finite
+      return (d == 0.0f) ? 0.0f : angle;
+    }
+    else
+    {
+      // Handle special cases
+      const float axis = (y >= 0.0f) ? half_pi : -half_pi;
+      angle = (abs_x < 1e-7f) ? axis : angle;
+      return (abs_x < 1e-7f && abs_y < 1e-7f) ? 0.0f : angle;
+    }
+  }
+
+  FAST_MATH_INLINE float
+  atan(float x)
+  {
+    return atan<Precision::Medium>(x);
+  }
+
+  FAST_MATH_INLINE float
+  atan2(float y, float x)
+  {
+    return atan2<Precision::Medium>(y, x);
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief 2^n for an integer n in [-126, 127]
+     * @note 2^n = (n + 127) << 23 in IEEE 754 format
+     */
+    inline float
+    pow2i(int n)
+    {
+      union
+      {
+        float f;
+        int i;
+      } result;
+      result.i = (n + 127) << 23;
+      return result.f;
+    }
+
+    /**
+     * @brief Splits fx into the nearest integer n and r = (fx - n) * ln(2),
+     *        so that 2^fx = 2^n * e^r with r in [-ln(2)/2, ln(2)/2]
+     * @note Shared range reduction of the exp family; exp passes x / ln(2),
+     *       exp10 x * log2(10) and exp2 x itself
+     */
+    inline float
+    exp_reduce(float fx, int &n)
+    {
+      constexpr float ln2 = 0.69314718055994531f;
+      n = static_cast<int>(fx + (fx >= 0.0f ? 0.5f : -0.5f));
+      return (fx - static_cast<float>(n)) * ln2;
+    }
+
+    /**
+     * @brief e^r - 1 for r in [-ln(2)/2, ln(2)/2]
+     * @note 5th order Taylor polynomial r + r²/2! + r³/3! + r⁴/4! + r⁵/5!;
+     *       no constant term, so small r keep their relative precision
+     */
+    inline float
+    expm1_poly(float r)
+    {
+      float r2 = r * r;
+      return r + 0.5f * r2 + r2 * r * (1.0f / 6.0f + r * (1.0f / 24.0f + r * (1.0f / 120.0f)));
+    }
+
+    /**
+     * @brief Splits x > 0 into a binary exponent and a mantissa
+     * @param exponent Receives the exponent e, x = 2^e * m
+     * @return m in [1, 2), or in [√½, √2) when Centred
+     * @note Centring keeps |(m - 1) / (m + 1)| below 0.172 and keeps
+     *       x just below 1 in exponent 0, where e * ln(2) would otherwise
+     *       cancel against log(m)
+     */
+    template <bool Centred>
+    inline float
+    log_reduce(float x, int &exponent)
+    {
+      union
+      {
+        float f;
+        int i;
+      } input;
+      input.f = x;
+
+      // IEEE 754: extract exponent (remove bias of 127)
+      exponent = ((input.i >> 23) & 0xFF) - 127;
+
+      // Extract mantissa and normalize to [1, 2)
+      input.i = (input.i & 0x007FFFFF) | 0x3F800000; // Set exponent to 127 (bias for 1.0)
+      float mantissa = input.f;
+
+      if constexpr (Centred)
+      {
+        constexpr float sqrt2 = 1.41421356237309505f;
+        const bool upper = mantissa > sqrt2;
+        mantissa = upper ? 0.5f * mantissa : mantissa;
+        exponent += upper ? 1 : 0;
+      }
+      return mantissa;
+    }
+
+    /**
+     * @brief 2 atanh(t) = 2t(1 + t²/3 + t⁴/5 + t⁶/7 + t⁸/9)
+     */
+    inline float
+    atanh_series(float t)
+    {
+      float t2 = t * t;
+      return t * (2.0f + t2 * (2.0f / 3.0f + t2 * (2.0f / 5.0f + t2 * (2.0f / 7.0f + t2 * 2.0f / 9.0f))));
+    }
+
+    /**
+     * @brief log(m) = 2 atanh(t), t = (m - 1) / (m + 1)
+     */
+    inline float
+    log_series(float mantissa)
+    {
+      return atanh_series((mantissa - 1.0f) / (mantissa + 1.0f));
+    }
+  } // namespace detail
+
+  /**
+   * @brief Fast exponential function
+   * @param x Input value
+   * @return e^x
+   * @note Uses range reduction and polynomial approximation
+   *       Based on exp(x) = 2^(x/ln(2)) with optimized computation.
+   *       Extreme inputs are clamped up front and their results selected at
+   *       the end, so the body has no early returns and vectorizes.
+   */
+  template <Precision P>
+  FAST_MATH_INLINE float
+  exp(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Exp, x);
+    FAST_MATH_PROFILE_PATH(ExpOverflow, x > 88.0f);
+    FAST_MATH_PROFILE_PATH(ExpUnderflow, x < -87.0f);
+
+    // Clamp to the representable range; saturated results are selected below
+    float xc = (x > 88.0f) ? 88.0f : ((x < -87.0f) ? -87.0f : x);
+
+    // Range reduction: exp(x) = 2^(x/ln(2)) = 2^n * e^r
+    constexpr float inv_ln2 = 1.44269504088896341f; // 1/ln(2)
+    int n;
+    float r = detail::exp_reduce(xc * inv_ln2, n);
+    if constexpr (P == Precision::High)
+    {
+      // r = x - n*ln(2) in double, free of the rounding error of x/ln(2)
+      constexpr double ln2 = 0.6931471805599453;
+      r = static_cast<float>(static_cast<double>(xc) - static_cast<double>(n) * ln2);
+    }
+
+    float r2 = r * r;
+    float poly;
+    if constexpr (P == Precision::High)
+    {
+      // Chebyshev fit of (exp(r) - 1 - r) / r², relative error below 1.1e-8
+      poly = 1.0f + r +
+             r2 * (5.000000000e-01f +
+                   r * (1.666657703e-01f + r * (4.166655466e-02f + r * (8.363173075e-03f + r * 1.392617612e-03f))));
+    }
+    else if constexpr (P == Precision::Medium)
+    {
+      poly = 1.0f + detail::expm1_poly(r);
+    }
+    else
+    {
+      poly = 1.0f + r + 0.5f * r2;
+    }
+
+    // Combine with 2^n using bit manipulation, then handle extreme cases
+    float value = poly * detail::pow2i(n);
+    value = (x > 88.0f) ? 1e38f : value; // Avoid overflow
+    return (x < -87.0f) ? 0.0f : value;  // Underflow to zero
+  }
+
+  FAST_MATH_INLINE float
+  exp(float x)
+  {
+    return exp<Precision::Medium>(x);
+  }
+
+  /**
+   * @brief Fast base-2 exponential
+   * @param x Input value
+   * @return 2^x
+   */
+  FAST_MATH_INLINE float
+  exp2(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Exp2, x);
+    FAST_MATH_PROFILE_PATH(Exp2Overflow, x > 127.0f);
+    FAST_MATH_PROFILE_PATH(Exp2Underflow, x < -126.0f);
+
+    float xc = (x > 127.0f) ? 127.0f : ((x < -126.0f) ? -126.0f : x);
+    int n;
+    float r = detail::exp_reduce(xc, n);
+    float value = (1.0f + detail::expm1_poly(r)) * detail::pow2i(n);
+    value = (x > 127.0f) ? 1e38f : value;
+    return (x < -126.0f) ? 0.0f : value;
+  }
+
+  /**
+   * @brief Fast base-10 exponential
+   * @param x Input value
+   * @return 10^x
+   */
+  FAST_MATH_INLINE float
+  exp10(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Exp10, x);
+    FAST_MATH_PROFILE_PATH(Exp10Overflow, x > 38.0f);
+    FAST_MATH_PROFILE_PATH(Exp10Underflow, x < -37.0f);
+
+    constexpr float log2_10 = 3.32192809488736235f; // log2(10)
+    float xc = (x > 38.0f) ? 38.0f : ((x < -37.0f) ? -37.0f : x);
+    int n;
+    float r = detail::exp_reduce(xc * log2_10, n);
+    float value = (1.0f + detail::expm1_poly(r)) * detail::pow2i(n);
+    value = (x > 38.0f) ? 1e38f : value;
+    return (x < -37.0f) ? 0.0f : value;
+  }
+
+  /**
+   * @brief Fast exp(x) - 1
+   * @param x Input value
+   * @return e^x - 1
+   * @note For |x| < ln(2)/2 the reduction gives n = 0 and r = x (up to one
+   *       rounding of x/ln(2) * ln(2)), so the result is the polynomial alone
+   */
+  FAST_MATH_INLINE float
+  expm1(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Expm1, x);
+    FAST_MATH_PROFILE_PATH(Expm1Overflow, x > 88.0f);
+    FAST_MATH_PROFILE_PATH(Expm1Underflow, x < -87.0f);
+
+    constexpr float inv_ln2 = 1.44269504088896341f; // 1/ln(2)
+    float xc = (x > 88.0f) ? 88.0f : ((x < -87.0f) ? -87.0f : x);
+    int n;
+    float r = detail::exp_reduce(xc * inv_ln2, n);
+
+    // e^x - 1 = 2^n * (e^r - 1) + (2^n - 1); the second term is exact
+    const float scale = detail::pow2i(n);
+    float value = scale * detail::expm1_poly(r) + FAST_MATH_ASSOC_BARRIER(scale - 1.0f);
+    value = (x > 88.0f) ? 1e38f : value;
+    return (x < -87.0f) ? -1.0f : value;
+  }
+
+  /**
+   * @brief Fast natural logarithm
+   * @param x Input value (x > 0)
+   * @return ln(x)
+   * @note Uses bit manipulation for range reduction and polynomial approximation.
+   *       Invalid input is handled by a final select rather than an early
+   *       return, so the body vectorizes.
+   */
+  template <Precision P>
+  FAST_MATH_INLINE float
+  log(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Log, x);
+    FAST_MATH_PROFILE_PATH(LogNonPositive, x <= 0.0f);
+    FAST_MATH_PROFILE_PATH(LogOne, x == 1.0f);
+
+    // Range reduction: log(x) = log(2^e * m) = e*ln(2) + log(m)
+    // where m is in [1, 2), so log(m) is in [0, ln(2)]; High centres m
+    // on 1 instead
+    int exponent;
+    float mantissa = detail::log_reduce<P == Precision::High>(x, exponent);
+
+    // Transform mantissa to [-1/3, 1/3] for better polynomial convergence
+    // Using log((1+u)/(1-u)) = 2u(1 + u²/3 + u⁴/5 + ...)
+    float poly;
+    if constexpr (P == Precision::Low)
+    {
+      float t = (mantissa - 1.0f) / (mantissa + 1.0f);
+      poly = t * (2.0f + t * t * (2.0f / 3.0f));
+    }
+    else
+    {
+      poly = detail::log_series(mantissa);
+    }
+
+    // Combine: log(x) = exponent * ln(2) + log(mantissa)
+    float result;
+    if constexpr (P == Precision::High)
+    {
+      // ln(2) split so that exponent * ln2_hi is exact
+      constexpr float ln2_hi = 0.693359375f;
+      constexpr float ln2_lo = -2.12194440e-4f;
+      const float e = static_cast<float>(exponent);
+      result = e * ln2_hi + FAST_MATH_ASSOC_BARRIER(e * ln2_lo + poly);
+    }
+    else
+    {
+      constexpr float ln2 = 0.69314718055994531f;
+      result = static_cast<float>(exponent) * ln2 + poly;
+    }
+
+    result = (x == 1.0f) ? 0.0f : result;
+    return (x <= 0.0f) ? -1e38f : result; // Handle invalid input
+  }
+
+  FAST_MATH_INLINE float
+  log(float x)
+  {
+    return log<Precision::Medium>(x);
+  }
+
+  /**
+   * @brief Fast base-10 logarithm
+   * @param x Input value (x > 0)
+   * @return log10(x)
+   */
+  FAST_MATH_INLINE float
+  log10(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Log10, x);
+    FAST_MATH_PROFILE_PATH(Log10NonPositive, x <= 0.0f);
+    constexpr float log10_2 = 0.30102999566398120f;  // log10(2)
+    constexpr float inv_ln10 = 0.43429448190325176f; // 1/ln(10)
+
+    int exponent;
+    float mantissa = detail::log_reduce<true>(x, exponent);
+    float result = static_cast<float>(exponent) * log10_2 + detail::log_series(mantissa) * inv_ln10;
+    return (x <= 0.0f) ? -1e38f * inv_ln10 : result;
+  }
+
+  /**
+   * @brief Fast base-2 logarithm
+   * @param x Input value (x > 0)
+   * @return log2(x)
+   */
+  FAST_MATH_INLINE float
+  log2(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Log2, x);
+    FAST_MATH_PROFILE_PATH(Log2NonPositive, x <= 0.0f);
+    constexpr float inv_ln2 = 1.44269504088896341f; // 1/ln(2)
+
+    int exponent;
+    float mantissa = detail::log_reduce<true>(x, exponent);
+    float result = static_cast<float>(exponent) + detail::log_series(mantissa) * inv_ln2;
+    return (x <= 0.0f) ? -1e38f * inv_ln2 : result;
+  }
+
+  /**
+   * @brief Fast log(1 + x)
+   * @param x Input value (x > -1)
+   * @return ln(1 + x)
+   */
+  FAST_MATH_INLINE float
+  log1p(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Log1p, x);
+    FAST_MATH_PROFILE_PATH(Log1pInvalid, x <= -1.0f);
+
+    const float u = FAST_MATH_ASSOC_BARRIER(1.0f + x);
+    int exponent;
+    float mantissa = detail::log_reduce<true>(u, exponent);
+
+    // In the centred range (exponent 0) t = (u - 1) / (u + 1) = x / (2 + x)
+    // comes straight from x, so the bits of x rounded away in u survive.
+    // Outside it, x - (u - 1) is the rounding error of u (u - 1 is exact
+    // for u in [0.5, 2]); the barriers keep -ffast-math from folding it to
+    // 0, although GCC's vectorizer may still do so, costing ~1 ulp there.
+    const bool centred = exponent == 0;
+    const float t = centred ? x / (2.0f + x) : (mantissa - 1.0f) / (mantissa + 1.0f);
+    const float correction = centred ? 0.0f : (x - FAST_MATH_ASSOC_BARRIER(u - 1.0f)) / u;
+
+    // ln(2) split so that exponent * ln2_hi is exact
+    constexpr float ln2_hi = 0.693359375f;
+    constexpr float ln2_lo = -2.12194440e-4f;
+    const float e = static_cast<float>(exponent);
+    float result = e * ln2_hi + FAST_MATH_ASSOC_BARRIER(e * ln2_lo + detail::atanh_series(t) + correction);
+    return (x <= -1.0f) ? -1e38f : result;
+  }
+
+  /**
+   * @brief Fast power function (optimized)
+   * @param base Base value
+   * @param exponent Exponent value
+   * @return base^exponent
+   * @note Optimized with more special cases and integer exponent handling
+   */
+  FAST_MATH_INLINE float
+  pow(float base, float exponent)
+  {
+    FAST_MATH_PROFILE_CALL(Pow, base);
+
+    // Handle special cases first (most common optimizations)
+    if (exponent == 0.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowZeroExponent, 1.0f);
+    if (exponent == 1.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowUnitExponent, base);
+    if (base == 0.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowZeroBase, (exponent > 0.0f) ? 0.0f : 1e38f);
+    if (base == 1.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowUnitBase, 1.0f);
+
+    // Fast integer exponent cases
+    if (exponent == 2.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowSquare, base * base);
+    if (exponent == 3.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowCube, base * base * base);
+    if (exponent == 4.0f)
+    {
+      FAST_MATH_PROFILE_PATH(PowFourth, true);
+      float b2 = base * base;
+      return b2 * b2;
+    }
+    if (exponent == 0.5f)
+      return FAST_MATH_PROFILE_TAKEN(PowSquareRoot, sqrt(base));
+    if (exponent == -1.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowReciprocal, 1.0f / base);
+    if (exponent == -2.0f)
+      return FAST_MATH_PROFILE_TAKEN(PowInverseSquare, 1.0f / (base * base));
+
+    // Check for integer exponents (use fast integer power)
+    int int_exp = static_cast<int>(exponent);
+    if (exponent == static_cast<float>(int_exp) && std::abs(int_exp) <= 32)
+    {
+      FAST_MATH_PROFILE_PATH(PowInteger, true);
+      // Fast integer power using binary exponentiation
+      bool negative_result = false;
+      if (base < 0.0f && (int_exp & 1))
+      {
+        negative_result = true;
+        base = -base;
+      }
+      else if (base < 0.0f)
+      {
+        base = -base;
+      }
+
+      float result = 1.0f;
+      float current_base = base;
+      int abs_exp = std::abs(int_exp);
+
+      while (abs_exp > 0)
+      {
+        if (abs_exp & 1)
+        {
+          result *= current_base;
+        }
+        current_base *= current_base;
+        abs_exp >>= 1;
+      }
+
+      if (int_exp < 0)
+        result = 1.0f / result;
+      return negative_result ? -result : result;
+    }
+
+    // Handle negative base (only for integer exponents - already handled above)
+    if (base < 0.0f)
+    {
+      return FAST_MATH_PROFILE_TAKEN(PowNegativeBase, 0.0f); // Invalid: negative base with fractional exponent
+    }
+
+    // For positive base with fractional exponent: base^exponent = exp(exponent * log(base))
+    FAST_MATH_PROFILE_PATH(PowGeneral, true);
+    float result = exp(exponent * log(base));
+    return result;
+  }
+
+  namespace detail
+  {
+    /**
+     * @brief x^n by binary exponentiation, |n| <= 32; negative n are
+     *        inverted in double with the saturation of pow<N>(), so the
+     *        scalar and batch PowPlan paths agree
+     */
+    inline float
+    integer_power(float x, int n)
+    {
+      if (n < 0)
+      {
+        double result = 1.0;
+        double power = x;
+        for (int bits = -n; bits > 0; bits >>= 1)
+        {
+          result = (bits & 1) ? result * power : result;
+          power *= power;
+        }
+        return static_cast<float>((std::abs(result) < 1e-38) ? 1e38 : 1.0 / result);
+      }
+      float result = 1.0f;
+      float power = x;
+      for (int bits = n; bits > 0; bits >>= 1)
+      {
+        result = (bits & 1) ? result * power : result;
+        power *= power;
+      }
+      return result;
+    }
+
+    /**
+     * @brief pow() results for bases that are not positive: 0 for negative
+     *        bases (fractional exponent), 0 or 1e38 for a zero base
+     */
+    inline float
+    pow_select_base(float x, float value, bool positive_exponent)
+    {
+      const float zero_base = positive_exponent ? 0.0f : 1e38f;
+      return (x < 0.0f) ? 0.0f : ((x == 0.0f) ? zero_base : value);
+    }
+
+    using PowKernel = void (*)(const float *, float *, std::size_t);
+
+    template <int N>
+    inline void
+    pow_integer(const float *in, float *out, std::size_t n)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        out[i] = pow<N>(in[i]);
+      }
+    }
+
+    /**
+     * @brief pow<N> batch loop for exponent - 32 = N, N in [-32, 32]
+     */
+    template <int... I>
+    inline PowKernel
+    pow_integer_kernel(int exponent, std::integer_sequence<int, I...>)
+    {
+      static constexpr PowKernel kernels[] = {pow_integer<I - 32>...};
+      return kernels[exponent + 32];
+    }
+
+    inline PowKernel
+    pow_integer_kernel(int exponent)
+    {
+      return pow_integer_kernel(exponent, std::make_integer_sequence<int, 65>());
+    }
+  } // namespace detail
+
+  FAST_MATH_INLINE
+  PowPlan::PowPlan(float exponent) : exponent_(exponent), kind_(Kind::General), integer_(0)
+  {
+    const float whole = std::floor(exponent);
+    if (exponent == 0.0f)
+    {
+      kind_ = Kind::One;
+    }
+    else if (exponent == 1.0f)
+    {
+      kind_ = Kind::Identity;
+    }
+    else if (exponent == whole && std::abs(whole) <= 32.0f)
+    {
+      kind_ = Kind::Integer;
+      integer_ = static_cast<int>(whole);
+    }
+    else if (exponent - whole == 0.5f && std::abs(exponent) < 16.0f)
+    {
+      // x^(n + 0.5) = sqrt(x)^(2n + 1), or rsqrt(x)^(-2n - 1) below zero;
+      // unlike x^n * sqrt(x), no intermediate power can overflow
+      kind_ = Kind::HalfInteger;
+      integer_ = static_cast<int>(std::abs(2.0f * exponent));
+    }
+  }
+
+  FAST_MATH_INLINE float
+  PowPlan::operator()(float x) const
+  {
+    switch (kind_)
+    {
+    case Kind::One:
+      return 1.0f;
+    case Kind::Identity:
+      return x;
+    case Kind::Integer:
+      return detail::integer_power(x, integer_);
+    case Kind::HalfInteger:
+    {
+      const float root = (exponent_ > 0.0f) ? sqrt(x) : rsqrt(x);
+      return detail::pow_select_base(x, detail::integer_power(root, integer_), exponent_ > 0.0f);
+    }
+    case Kind::General:
+    default:
+      return detail::pow_select_base(x, exp2(exponent_ * log2(x)), exponent_ > 0.0f);
+    }
+  }
+
+  /**
+   * @note The half-integer and general kinds run the batch sqrt/rsqrt,
+   *       log2 and exp2 kernels over a stack tile, then a select pass for
+   *       the base special cases; reading in[i] only before writing out[i]
+   *       keeps in-place calls valid.
+   */
+  FAST_MATH_INLINE void
+  PowPlan::operator()(const float *in, float *out, std::size_t n) const
+  {
+    constexpr std::size_t tile = 512;
+    float first[tile];
+    const bool positive_exponent = exponent_ > 0.0f;
+
+    switch (kind_)
+    {
+    case Kind::One:
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        out[i] = 1.0f;
+      }
+      break;
+    case Kind::Identity:
+      if (in != out && n > 0)
+      {
+        std::memmove(out, in, n * sizeof(float));
+      }
+      break;
+    case Kind::Integer:
+      detail::pow_integer_kernel(integer_)(in, out, n);
+      break;
+    case Kind::HalfInteger:
+      for (std::size_t begin = 0; begin < n; begin += tile)
+      {
+        const std::size_t count = (n - begin < tile) ? n - begin : tile;
+        if (positive_exponent)
+        {
+          sqrt(in + begin, first, count);
+        }
+        else
+        {
+          rsqrt(in + begin, first, count);
+        }
+        detail::pow_integer_kernel(integer_)(first, first, count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          out[begin + i] = detail::pow_select_base(in[begin + i], first[i], positive_exponent);
+        }
+      }
+      break;
+    case Kind::General:
+    default:
+      for (std::size_t begin = 0; begin < n; begin += tile)
+      {
+        const std::size_t count = (n - begin < tile) ? n - begin : tile;
+        log2(in + begin, first, count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          first[i] *= exponent_;
+        }
+        exp2(first, first, count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          out[begin + i] = detail::pow_select_base(in[begin + i], first[i], positive_exponent);
+        }
+      }
+      break;
+    }
+  }
+
+  FAST_MATH_INLINE void
+  pow_batch(const float *in, float *out, std::size_t n, float exponent)
+  {
+    const PowPlan plan(exponent);
+    plan(in, out, n);
+  }
+
+  /**
+   * @brief Fast floating-point remainder function
+   * @param dividend The dividend
+   * @param divisor The divisor
+   * @return Floating-point remainder of dividend/divisor
+   * @note Hybrid implementation: fast method for small values, std::fmod for large values
+   */
+  FAST_MATH_INLINE float
+  fmod(float dividend, float divisor)
+  {
+    FAST_MATH_PROFILE_CALL(Fmod, dividend);
+
+    if (divisor == 0.0f)
+      return FAST_MATH_PROFILE_TAKEN(FmodZeroDivisor, 0.0f); // Handle division by zero
+    if (std::abs(dividend) < std::abs(divisor))
+      return FAST_MATH_PROFILE_TAKEN(FmodSmallDividend, dividend);
+
+    // Define precision-safe range based on empirical testing
+    // Use extremely conservative threshold to ensure high precision
+    constexpr float max_safe_value = 25.0f; // Extremely conservative threshold
+
+    // Use standard library for large values to maintain precision
+    if (std::abs(dividend) > max_safe_value || std::abs(divisor) > max_safe_value)
+    {
+      return FAST_MATH_PROFILE_TAKEN(FmodLargeOperand, std::fmod(dividend, divisor));
+    }
+
+    // Fast method for smaller values: fmod(x,y) = x - trunc(x/y) * y
+    float quotient = dividend / divisor;
+
+    // Additional safety check: if quotient is too large, use standard library
+    if (std::abs(quotient) > max_safe_value)
+    {
+      return FAST_MATH_PROFILE_TAKEN(FmodLargeQuotient, std::fmod(dividend, divisor));
+    }
+    FAST_MATH_PROFILE_PATH(FmodFast, true);
+
+    // Fast truncation towards zero (safe for smaller values)
+    int int_quotient = static_cast<int>(quotient);
+    float truncated_quotient = static_cast<float>(int_quotient);
+
+    return dividend - truncated_quotient * divisor;
+  }
+
+  namespace detail
+  {
+    /// Quotients below this take the reciprocal step of fmod_batch()
+    constexpr float reciprocal_quotient_limit = 2097152.0f; // 2^21
+
+    /**
+     * @brief r - q * d, rounded once
+     * @note Exact when q is an integer within one of r / d: the result is
+     *       then smaller than d and a multiple of ulp(d), or r itself.
+     *       Without hardware FMA the product is formed in double, where
+     *       q * d (at most 45 significant bits) is exact as well.
+     */
+    inline float
+    remainder_step(float r, float q, float d)
+    {
+#ifdef FP_FAST_FMAF
+      return std::fma(-q, d, r);
+#else
+      return static_cast<float>(static_cast<double>(r) - static_cast<double>(q) * static_cast<double>(d));
+#endif
+    }
+
+    /**
+     * @brief fmod(x, d) for d > 0 with a precomputed inverse = 1 / d
+     * @return The exact remainder, or x unchanged when |x| / d is not below
+     *         reciprocal_quotient_limit (finished by fmod_exact())
+     * @note Branch-free so that batch loops vectorize. The rounding of
+     *       |x| * inverse moves q = round(|x| / d) by less than one below
+     *       2^21, so remainder_step() is exact and one correction brings a
+     *       negative step result into [0, d).
+     */
+    inline float
+    fmod_reciprocal(float x, float d, float inverse)
+    {
+      const float ax = std::abs(x);
+      const float t = ax * inverse;
+      // Written as "small" so that a NaN quotient also takes the pass-through
+      const bool small = t < reciprocal_quotient_limit;
+      const float q = static_cast<float>(static_cast<int>((small ? t : 0.0f) + 0.5f));
+      float r = remainder_step(ax, q, d);
+      r = (r < 0.0f) ? r + d : r;
+      return small ? std::copysign(r, x) : x;
+    }
+
+    /**
+     * @brief fmod(x, d) for normal d > 0 and any quotient, exactly
+     * @note Long division 20 quotient bits at a time: d is scaled by a power
+     *       of two so that each quotient stays below 2^21, and a remainder
+     *       modulo d * 2^k is still congruent modulo d. Each step removes
+     *       at least 20 of the at most 253 exponent steps between x and d,
+     *       so 14 steps suffice. An inf or NaN dividend gives NaN, as
+     *       std::fmod; it is detected from the exponent bits because
+     *       std::isfinite() folds to true under -ffinite-math-only.
+     */
+    inline float
+    fmod_exact(float x, float d)
+    {
+      std::uint32_t bits;
+      std::memcpy(&bits, &x, sizeof(bits));
+      if ((bits & 0x7F800000) == 0x7F800000)
+      {
+        return std::numeric_limits<float>::quiet_NaN();
+      }
+
+      float r = std::abs(x);
+      for (int steps = 0; steps < 14 && r >= d; ++steps)
+      {
+        const int shift = std::ilogb(r) - std::ilogb(d) - 20;
+        const float step = (shift > 0) ? std::ldexp(d, shift) : d;
+        const float q = static_cast<float>(static_cast<int>(r / step + 0.5f));
+        r = remainder_step(r, q, step);
+        r = (r < 0.0f) ? r + step : r;
+      }
+      return std::copysign(r, x);
+    }
+
+    /**
+     * @brief IEEE remainder(x, d) from f = fmod(x, 2d), for d >= 0
+     * @note f carries the parity of the quotient: |f| >= d means it is odd,
+     *       which settles ties. Every subtraction is exact (Sterbenz).
+     */
+    inline float
+    remainder_from_fmod(float f, float d)
+    {
+      const float a = std::abs(f);
+      const bool odd = a >= d;
+      const float r = odd ? a - d : a;
+      const float rest = d - r;
+      const float result = (r > rest || (r == rest && odd)) ? -rest : r;
+      return (f < 0.0f) ? -result : result;
+    }
+  } // namespace detail
+
+  /**
+   * @brief Wrap an angle into [-π, π)
+   * @param theta Angle in radians
+   * @return theta - 2πk for the integer k that lands in [-π, π)
+   * @note Same reduction as sin(): float accuracy up to |theta| ≈ 1e9 and
+   *       within [-π, π) for any finite theta (exact beyond 2^30 with
+   *       FAST_MATH_PAYNE_HANEK)
+   */
+  FAST_MATH_INLINE float
+  wrap_angle(float theta)
+  {
+    FAST_MATH_PROFILE_CALL(WrapAngle, theta);
+    FAST_MATH_PROFILE_PATH(WrapAngleLargeArgument, std::abs(theta) > 0x1p30f);
+    constexpr float pi = 3.14159265358979323846f;
+
+    // reduce_two_pi() lands in [-π, π]; float(π) is above π, so a result
+    // rounded up to it moves to -float(π), exactly
+    const float r = detail::reduce_two_pi(theta);
+    return (r >= pi) ? r - 2.0f * pi : r;
+  }
+
+  /**
+   * @brief Fast ceiling function
+   * @param x Input value
+   * @return Smallest integer >= x
+   * @note Uses bit manipulation and efficient integer conversion
+   */
+  FAST_MATH_INLINE float
+  ceil(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Ceil, x);
+    FAST_MATH_PROFILE_PATH(CeilNegative, x < 0.0f);
+    if (x >= 0.0f)
+    {
+      int int_x = static_cast<int>(x);
+      return (x > static_cast<float>(int_x)) ? static_cast<float>(int_x + 1) : static_cast<float>(int_x);
+    }
+    else
+    {
+      int int_x = static_cast<int>(x);
+      return static_cast<float>(int_x);
+    }
+  }
+
+  /**
+   * @brief Fast floor function
+   * @param x Input value
+   * @return Largest integer <= x
+   * @note Uses bit manipulation and efficient integer conversion
+   */
+  FAST_MATH_INLINE float
+  floor(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Floor, x);
+    FAST_MATH_PROFILE_PATH(FloorNegative, x < 0.0f);
+    if (x >= 0.0f)
+    {
+      int int_x = static_cast<int>(x);
+      return static_cast<float>(int_x);
+    }
+    else
+    {
+      int int_x = static_cast<int>(x);
+      return (x < static_cast<float>(int_x)) ? static_cast<float>(int_x - 1) : static_cast<float>(int_x);
+    }
+  }
+
+  /**
+   * @brief Fast round function
+   * @param x Input value
+   * @return Nearest integer to x
+   * @note Uses efficient rounding to nearest even (banker's rounding)
+   */
+  FAST_MATH_INLINE float
+  round(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Round, x);
+    FAST_MATH_PROFILE_PATH(RoundNegative, x < 0.0f);
+    if (x >= 0.0f)
+    {
+      return floor(x + 0.5f);
+    }
+    else
+    {
+      return ceil(x - 0.5f);
+    }
+  }
+
+  /**
+   * @brief Fast hyperbolic sine
+   * @param x Input value
+   * @return sinh(x) = (e^x - e^(-x)) / 2
+   * @note Uses optimized exp function and symmetry properties
+   */
+  FAST_MATH_INLINE float
+  sinh(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Sinh, x);
+    FAST_MATH_PROFILE_PATH(SinhTaylor, std::abs(x) < 0.5f);
+    FAST_MATH_PROFILE_PATH(SinhExp, !(std::abs(x) < 0.5f));
+
+    // Handle small values with Taylor series: sinh(x) ≈ x + x³/6 for |x| < 0.5
+    if (std::abs(x) < 0.5f)
+    {
+      float x2 = x * x;
+      return x * (1.0f + x2 * (1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 / 5040.0f)));
+    }
+
+    // For larger values: sinh(x) = (e^x - e^(-x)) / 2
+    // Use symmetry: sinh(-x) = -sinh(x)
+    bool negative = x < 0.0f;
+    if (negative)
+      x = -x;
+
+    float exp_x = exp(x);
+    float exp_neg_x = 1.0f / exp_x;
+    float result = 0.5f * (exp_x - exp_neg_x);
+
+    return negative ? -result : result;
+  }
+
+  /**
+   * @brief Fast hyperbolic cosine
+   * @param x Input value
+   * @return cosh(x) = (e^x + e^(-x)) / 2
+   * @note Uses optimized exp function and even function property
+   */
+  FAST_MATH_INLINE float
+  cosh(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Cosh, x);
+    FAST_MATH_PROFILE_PATH(CoshTaylor, std::abs(x) < 0.5f);
+    FAST_MATH_PROFILE_PATH(CoshExp, !(std::abs(x) < 0.5f));
+
+    // Handle small values with Taylor series: cosh(x) ≈ 1 + x²/2 for |x| < 0.5
+    if (std::abs(x) < 0.5f)
+    {
+      float x2 = x * x;
+      return 1.0f + x2 * (0.5f + x2 * (1.0f / 24.0f + x2 * (1.0f / 720.0f + x2 / 40320.0f)));
+    }
+
+    // For larger values: cosh(x) = (e^x + e^(-x)) / 2
+    // cosh is even function: cosh(-x) = cosh(x)
+    x = std::abs(x);
+
+    float exp_x = exp(x);
+    float exp_neg_x = 1.0f / exp_x;
+    return 0.5f * (exp_x + exp_neg_x);
+  }
+
+  /**
+   * @brief Fast hyperbolic tangent
+   * @param x Input value
+   * @return tanh(x) = sinh(x) / cosh(x)
+   * @note Uses optimized rational approximation for better performance.
+   *       Both the Taylor and the exp form are evaluated and the result is
+   *       selected, so the body has no branches and vectorizes.
+   */
+  FAST_MATH_INLINE float
+  tanh(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Tanh, x);
+    FAST_MATH_PROFILE_PATH(TanhTaylor, std::abs(x) < 0.5f);
+    FAST_MATH_PROFILE_PATH(TanhExp, std::abs(x) >= 0.5f && std::abs(x) <= 5.0f);
+    FAST_MATH_PROFILE_PATH(TanhSaturated, std::abs(x) > 5.0f);
+
+    // For small values, use Taylor series: tanh(x) ≈ x - x³/3 + 2x⁵/15
+    float x2 = x * x;
+    float taylor = x * (1.0f - x2 * (1.0f / 3.0f - x2 * (2.0f / 15.0f - x2 * 17.0f / 315.0f)));
+
+    // For medium values, use efficient formula: tanh(x) = (e^(2x) - 1) / (e^(2x) + 1)
+    float exp_2x = exp(2.0f * x);
+    float result = (exp_2x - 1.0f) / (exp_2x + 1.0f);
+
+    result = (std::abs(x) < 0.5f) ? taylor : result;
+
+    // Handle extreme values
+    result = (x > 5.0f) ? 1.0f : result;
+    return (x < -5.0f) ? -1.0f : result;
+  }
+
+  /**
+   * @brief Fast inverse hyperbolic sine
+   * @param x Input value
+   * @return asinh(x) = log(x + sqrt(x² + 1))
+   * @note Uses optimized log and sqrt functions
+   */
+  FAST_MATH_INLINE float
+  asinh(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Asinh, x);
+    FAST_MATH_PROFILE_PATH(AsinhTaylor, std::abs(x) < 0.5f);
+    FAST_MATH_PROFILE_PATH(AsinhLog, !(std::abs(x) < 0.5f));
+
+    // Handle small values with Taylor series: asinh(x) ≈ x - x³/6 + 3x⁵/40
+    if (std::abs(x) < 0.5f)
+    {
+      float x2 = x * x;
+      return x * (1.0f - x2 * (1.0f / 6.0f - x2 * (3.0f / 40.0f - x2 * 15.0f / 336.0f)));
+    }
+
+    // Use symmetry: asinh(-x) = -asinh(x)
+    bool negative = x < 0.0f;
+    if (negative)
+      x = -x;
+
+    // For larger values: asinh(x) = log(x + sqrt(x² + 1))
+    float result = log(x + sqrt(x * x + 1.0f));
+
+    return negative ? -result : result;
+  }
+
+  /**
+   * @brief Fast inverse hyperbolic cosine
+   * @param x Input value (x >= 1)
+   * @return acosh(x) = log(x + sqrt(x² - 1))
+   * @note Uses optimized log and sqrt functions
+   */
+  FAST_MATH_INLINE float
+  acosh(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Acosh, x);
+
+    if (x < 1.0f)
+      return FAST_MATH_PROFILE_TAKEN(AcoshInvalid, 0.0f); // Invalid input, return 0
+
+    // Handle values close to 1 with Taylor series
+    if (x < 1.5f)
+    {
+      FAST_MATH_PROFILE_PATH(AcoshTaylor, true);
+      float t = x - 1.0f;
+      float sqrt_2t = sqrt(2.0f * t);
+      return sqrt_2t * (1.0f - t * (1.0f / 12.0f - t * (3.0f / 160.0f - t * 5.0f / 896.0f)));
+    }
+
+    // For larger values: acosh(x) = log(x + sqrt(x² - 1))
+    FAST_MATH_PROFILE_PATH(AcoshLog, true);
+    return log(x + sqrt(x * x - 1.0f));
+  }
+
+  /**
+   * @brief Fast inverse hyperbolic tangent
+   * @param x Input value (-1 < x < 1)
+   * @return atanh(x) = 0.5 * log((1 + x) / (1 - x))
+   * @note Uses optimized log function
+   */
+  FAST_MATH_INLINE float
+  atanh(float x)
+  {
+    FAST_MATH_PROFILE_CALL(Atanh, x);
+
+    // Handle boundary cases
+    if (std::abs(x) >= 1.0f)
+      return FAST_MATH_PROFILE_TAKEN(AtanhInvalid, 0.0f); // Invalid input
+
+    // Handle small values with Taylor series: atanh(x) ≈ x + x³/3 + 2x⁵/15
+    if (std::abs(x) < 0.5f)
+    {
+      FAST_MATH_PROFILE_PATH(AtanhTaylor, true);
+      float x2 = x * x;
+      return x * (1.0f + x2 * (1.0f / 3.0f + x2 * (2.0f / 15.0f + x2 * 17.0f / 315.0f)));
+    }
+
+    // For larger values: atanh(x) = 0.5 * log((1 + x) / (1 - x))
+    FAST_MATH_PROFILE_PATH(AtanhLog, true);
+    return 0.5f * log((1.0f + x) / (1.0f - x));
+  }
+
+  namespace detail
+  {
+    /**
+     * Element-wise loop shared by every unary batch entry point.
+     * The scalar function is passed as a lambda so that it is inlined into the
+     * loop body, letting the compiler unroll and vectorize the whole transform.
+     */
+    template <typename Function>
+    inline void
+    transform(const float *in, float *out, std::size_t n, Function function)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        out[i] = function(in[i]);
+      }
+    }
+
+    template <typename Function>
+    inline void
+    transform(const float *a, const float *b, float *out, std::size_t n, Function function)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        out[i] = function(a[i], b[i]);
+      }
+    }
+
+    /// rsqrt of a squared length, 0 where normalize() maps the vector to zero
+    inline float
+    inverse_length(float length_squared)
+    {
+      return (length_squared < 1.17549435e-38f) ? 0.0f : rsqrt(length_squared);
+    }
+
+    inline void
+    normalize(const float *x, const float *y, float *out_x, float *out_y, std::size_t n)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const float scale = inverse_length(x[i] * x[i] + y[i] * y[i]);
+        out_x[i] = x[i] * scale;
+        out_y[i] = y[i] * scale;
+      }
+    }
+
+    inline void
+    normalize(const float *x, const float *y, const float *z, float *out_x, float *out_y, float *out_z,
+              std::size_t n)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const float scale = inverse_length(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        out_x[i] = x[i] * scale;
+        out_y[i] = y[i] * scale;
+        out_z[i] = z[i] * scale;
+      }
+    }
+
+    /**
+     * @brief fmod_batch() around a kernel applying fmod_reciprocal()
+     * @note The kernel passes large-quotient elements through unchanged,
+     *       so they are the only outputs with |out[i]| >= |divisor| and the
+     *       exact pass can find them in out[] even for in-place calls.
+     */
+    template <typename Kernel>
+    inline void
+    fmod_batch(const float *in, float *out, std::size_t n, float divisor, Kernel reciprocal_kernel)
+    {
+      const float d = std::abs(divisor);
+      if (d == 0.0f)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          out[i] = 0.0f;
+        }
+        return;
+      }
+
+      // 1 / d overflows for subnormal divisors, and with denormals flushed
+      // (-ffast-math startup code) the long division would see d as 0
+      if (d < 1.17549435e-38f)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          out[i] = std::fmod(in[i], d);
+        }
+        return;
+      }
+
+      reciprocal_kernel(in, out, n, d, 1.0f / d);
+
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        if (std::abs(out[i]) >= d)
+        {
+          out[i] = fmod_exact(out[i], d);
+        }
+      }
+    }
+  } // namespace detail
+
+  FAST_MATH_INLINE void
+  remainder_batch(const float *in, float *out, std::size_t n, float divisor)
+  {
+    const float d = std::abs(divisor);
+    fmod_batch(in, out, n, 2.0f * d);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      out[i] = detail::remainder_from_fmod(out[i], d);
+    }
+  }
+
+#ifdef FAST_MATH_HEADER_ONLY
+  // ---------------------------------------------------------------------------
+  // Batch (array) API, header-only mode
+  //
+  // Plain loops over the inline scalar functions; there is no runtime
+  // dispatch, so vectorization is left to the user's compiler flags.
+  // ---------------------------------------------------------------------------
+
+  inline Isa
+  active_isa()
+  {
+    return Isa::Generic;
+  }
+
+  inline void
+  sin(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return sin(x); });
+  }
+
+  inline void
+  cos(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return cos(x); });
+  }
+
+  inline void
+  sincos(const float *in, float *sin_out, float *cos_out, std::size_t n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const float reduced = detail::reduce_two_pi(in[i]);
+      sin_out[i] = detail::sin_reduced(reduced);
+      cos_out[i] = detail::cos_reduced(reduced);
+    }
+  }
+
+  inline void
+  sqrt(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return sqrt(x); });
+  }
+
+  inline void
+  rsqrt(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return rsqrt(x); });
+  }
+
+  inline void
+  normalize(const float *x, const float *y, float *out_x, float *out_y, std::size_t n)
+  {
+    detail::normalize(x, y, out_x, out_y, n);
+  }
+
+  inline void
+  normalize(const float *x, const float *y, const float *z, float *out_x, float *out_y, float *out_z,
+            std::size_t n)
+  {
+    detail::normalize(x, y, z, out_x, out_y, out_z, n);
+  }
+
+  inline void
+  tan(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return tan(x); });
+  }
+
+  inline void
+  asin(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return asin(x); });
+  }
+
+  inline void
+  acos(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return acos(x); });
+  }
+
+  inline void
+  atan(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return atan(x); });
+  }
+
+  inline void
+  atan2(const float *y, const float *x, float *out, std::size_t n)
+  {
+    detail::transform(y, x, out, n, [](float a, float b) { return atan2(a, b); });
+  }
+
+  inline void
+  exp(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return exp(x); });
+  }
+
+  inline void
+  exp2(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return exp2(x); });
+  }
+
+  inline void
+  exp10(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return exp10(x); });
+  }
+
+  inline void
+  expm1(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return expm1(x); });
+  }
+
+  inline void
+  log(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return log(x); });
+  }
+
+  inline void
+  log10(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return log10(x); });
+  }
+
+  inline void
+  log2(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return log2(x); });
+  }
+
+  inline void
+  log1p(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return log1p(x); });
+  }
+
+  inline void
+  pow(const float *base, const float *exponent, float *out, std::size_t n)
+  {
+    detail::transform(base, exponent, out, n, [](float a, float b) { return pow(a, b); });
+  }
+
+  inline void
+  fmod(const float *dividend, const float *divisor, float *out, std::size_t n)
+  {
+    detail::transform(dividend, divisor, out, n, [](float a, float b) { return fmod(a, b); });
+  }
+
+  inline void
+  fmod_batch(const float *in, float *out, std::size_t n, float divisor)
+  {
+    detail::fmod_batch(in, out, n, divisor,
+                       [](const float *x, float *y, std::size_t count, float d, float inverse) {
+                         detail::transform(x, y, count, [d, inverse](float v) {
+                           return detail::fmod_reciprocal(v, d, inverse);
+                         });
+                       });
+  }
+
+  inline void
+  wrap_angle(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return wrap_angle(x); });
+  }
+
+  inline void
+  ceil(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return ceil(x); });
+  }
+
+  inline void
+  floor(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return floor(x); });
+  }
+
+  inline void
+  round(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return round(x); });
+  }
+
+  inline void
+  sinh(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return sinh(x); });
+  }
+
+  inline void
+  cosh(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return cosh(x); });
+  }
+
+  inline void
+  tanh(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return tanh(x); });
+  }
+
+  inline void
+  asinh(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return asinh(x); });
+  }
+
+  inline void
+  acosh(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return acosh(x); });
+  }
+
+  inline void
+  atanh(const float *in, float *out, std::size_t n)
+  {
+    detail::transform(in, out, n, [](float x) { return atanh(x); });
+  }
+
+#endif // FAST_MATH_HEADER_ONLY
+
+} // namespace FastMath
@@ -0,0 +1,527 @@
+/**
+ * @file fast_math_parallel.hpp
+ * @brief Multi-threaded batch evaluation on a persistent work-stealing pool
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * parallel::transform() splits an array into cache-sized chunks and runs
+ * the batch API (and so the AVX2/AVX-512 kernels) on every chunk across the
+ * threads of a ThreadPool:
+ *
+ *   FastMath::parallel::ThreadPool pool;            // once, all cores
+ *   FastMath::parallel::transform(pool, in, out, n, FastMath::op::exp);
+ *
+ * Each participant starts on a fixed contiguous share of the chunks and
+ * steals single chunks from the end of other shares once its own is done,
+ * so uneven chunk costs (e.g. slow paths in part of the array) are balanced
+ * without a central queue. Because the initial shares only depend on n,
+ * the chunk size and the pool size, buffers written once with
+ * parallel::first_touch() on the same pinned pool are placed on the NUMA
+ * node of the thread that later processes them; the calling thread, which
+ * runs participant 0's share, is pinned for the duration of each loop.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef FAST_MATH_TIMED_WAIT
+#include <chrono>
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "fast_math.hpp"
+
+namespace FastMath
+{
+  /**
+   * @brief Batch operations as function objects, for parallel::transform
+   * @note op::exp(in, out, n) is FastMath::exp(in, out, n). Passing the
+   *       object rather than the overloaded function lets the call be
+   *       resolved (and inlined) at compile time.
+   */
+  namespace op
+  {
+#define FAST_MATH_OP_UNARY(name)                                                                                       \
+  struct name##_op                                                                                                     \
+  {                                                                                                                    \
+    void                                                                                                               \
+    operator()(const float *in, float *out, std::size_t n) const                                                       \
+    {                                                                                                                  \
+      FastMath::name(in, out, n);                                                                                      \
+    }                                                                                                                  \
+  };                                                                                                                   \
+  inline constexpr name##_op name{};
+
+#define FAST_MATH_OP_BINARY(name)                                                                                      \
+  struct name##_op                                                                                                     \
+  {                                                                                                                    \
+    void                                                                                                               \
+    operator()(const float *a, const float *b, float *out, std::size_t n) const                                        \
+    {                                                                                                                  \
+      FastMath::name(a, b, out, n);                                                                                    \
+    }                                                                                                                  \
+  };                                                                                                                   \
+  inline constexpr name##_op name{};
+
+    FAST_MATH_OP_UNARY(sin)
+    FAST_MATH_OP_UNARY(cos)
+    FAST_MATH_OP_UNARY(sqrt)
+    FAST_MATH_OP_UNARY(rsqrt)
+    FAST_MATH_OP_UNARY(tan)
+    FAST_MATH_OP_UNARY(asin)
+    FAST_MATH_OP_UNARY(acos)
+    FAST_MATH_OP_UNARY(atan)
+    FAST_MATH_OP_UNARY(wrap_angle)
+    FAST_MATH_OP_UNARY(exp)
+    FAST_MATH_OP_UNARY(exp2)
+    FAST_MATH_OP_UNARY(exp10)
+    FAST_MATH_OP_UNARY(expm1)
+    FAST_MATH_OP_UNARY(log)
+    FAST_MATH_OP_UNARY(log10)
+    FAST_MATH_OP_UNARY(log2)
+    FAST_MATH_OP_UNARY(log1p)
+    FAST_MATH_OP_UNARY(ceil)
+    FAST_MATH_OP_UNARY(floor)
+    FAST_MATH_OP_UNARY(round)
+    FAST_MATH_OP_UNARY(sinh)
+    FAST_MATH_OP_UNARY(cosh)
+    FAST_MATH_OP_UNARY(tanh)
+    FAST_MATH_OP_UNARY(asinh)
+    FAST_MATH_OP_UNARY(acosh)
+    FAST_MATH_OP_UNARY(atanh)
+    FAST_MATH_OP_BINARY(atan2)
+    FAST_MATH_OP_BINARY(pow)
+    FAST_MATH_OP_BINARY(fmod)
+
+#undef FAST_MATH_OP_UNARY
+#undef FAST_MATH_OP_BINARY
+  } // namespace op
+
+  namespace parallel
+  {
+    /**
+     * @brief Default elements per chunk
+     * @note 16K floats: input and output of a chunk (128 KiB) stay in L2,
+     *       and a chunk takes tens of microseconds, which keeps the cost of
+     *       taking or stealing it negligible.
+     */
+    constexpr std::size_t default_chunk = 16384;
+
+    namespace detail
+    {
+      /**
+       * @brief condition.wait(lock, ready)
+       * @note With FAST_MATH_TIMED_WAIT (CMake option), a loop of one-second
+       *       timed waits instead: libstdc++ exports the untimed wait only
+       *       from GCC 12 (GLIBCXX_3.4.30), the timed one is inlined.
+       */
+      template <typename Ready>
+      inline void
+      wait(std::condition_variable &condition, std::unique_lock<std::mutex> &lock, Ready ready)
+      {
+#ifdef FAST_MATH_TIMED_WAIT
+        while (!condition.wait_for(lock, std::chrono::seconds(1), ready))
+        {
+        }
+#else
+        condition.wait(lock, ready);
+#endif
+      }
+    } // namespace detail
+
+    /**
+     * @brief Persistent threads that run one parallel loop at a time
+     * @note The thread calling run() takes part as participant 0, so a pool
+     *       of N participants starts N - 1 threads. Loops submitted from
+     *       several threads are serialized; a loop started from inside a
+     *       task of the same pool runs on the calling thread alone.
+     */
+    class ThreadPool
+    {
+    public:
+      /**
+       * @param threads Participants including the caller (0: one per
+       *        hardware thread)
+       * @param pin Pin participant i to the i-th CPU the process may run
+       *        on (Linux only), so that first-touched pages stay local. The
+       *        calling thread is pinned to the first one while it runs a
+       *        loop, and gets its previous affinity back afterwards.
+       */
+      explicit ThreadPool(unsigned threads = 0, bool pin = false)
+      {
+        if (threads == 0)
+        {
+          threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        shares_ = std::vector<Share>(threads);
+
+#ifdef __linux__
+        std::vector<int> cpus;
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (pin && sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+        {
+          for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+          {
+            if (CPU_ISSET(cpu, &allowed))
+            {
+              cpus.push_back(cpu);
+            }
+          }
+        }
+        if (!cpus.empty())
+        {
+          caller_cpu_ = cpus[0];
+        }
+#else
+        (void)pin;
+#endif
+
+        workers_.reserve(threads - 1);
+        for (unsigned i = 1; i < threads; ++i)
+        {
+          workers_.emplace_back([this, i] { work(i); });
+#ifdef __linux__
+          if (!cpus.empty())
+          {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpus[i % cpus.size()], &set);
+            pthread_setaffinity_np(workers_.back().native_handle(), sizeof(set), &set);
+          }
+#endif
+        }
+      }
+
+      ~ThreadPool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stop_ = true;
+          ++generation_;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_)
+        {
+          worker.join();
+        }
+      }
+
+      ThreadPool(const ThreadPool &) = delete;
+      ThreadPool &operator=(const ThreadPool &) = delete;
+
+      /// Participants, including the calling thread
+      unsigned
+      size() const
+      {
+        return static_cast<unsigned>(shares_.size());
+      }
+
+      /**
+       * @brief Call body(task) for every task in [0, tasks) and wait
+       * @note Participant p starts with tasks [p * tasks / size(),
+       *       (p + 1) * tasks / size()) and then steals from the others.
+       */
+      template <typename Body>
+      void
+      run(std::size_t tasks, const Body &body)
+      {
+        if (tasks == 0)
+        {
+          return;
+        }
+        // A loop started from a task runs inline, on that thread's affinity
+        if (current() == this)
+        {
+          for (std::size_t task = 0; task < tasks; ++task)
+          {
+            body(task);
+          }
+          return;
+        }
+
+        const CallerPin pin(caller_cpu_);
+        if (tasks == 1 || size() == 1)
+        {
+          for (std::size_t task = 0; task < tasks; ++task)
+          {
+            body(task);
+          }
+          return;
+        }
+
+        std::lock_guard<std::mutex> submit(submit_mutex_);
+        const unsigned participants = size();
+        for (unsigned p = 0; p < participants; ++p)
+        {
+          shares_[p].bounds.store(pack(tasks * p / participants, tasks * (p + 1) / participants),
+                                  std::memory_order_relaxed);
+        }
+        job_.context = &body;
+        job_.invoke = [](const void *context, std::size_t task) { (*static_cast<const Body *>(context))(task); };
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          busy_ = participants - 1;
+          ++generation_;
+        }
+        wake_.notify_all();
+
+        participate(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        detail::wait(done_, lock, [this] { return busy_ == 0; });
+      }
+
+    private:
+      /// Remaining tasks [begin, end) of one participant, packed in 64 bits
+      struct alignas(64) Share
+      {
+        std::atomic<std::uint64_t> bounds{0};
+      };
+
+      struct Job
+      {
+        const void *context = nullptr;
+        void (*invoke)(const void *, std::size_t) = nullptr;
+      };
+
+      static std::uint64_t
+      pack(std::size_t begin, std::size_t end)
+      {
+        return (static_cast<std::uint64_t>(begin) << 32) | static_cast<std::uint64_t>(end);
+      }
+
+      /**
+       * @brief Pins the calling thread to `cpu` (Linux, cpu >= 0) for its
+       *        lifetime and then restores the thread's previous affinity
+       */
+      class CallerPin
+      {
+      public:
+        explicit CallerPin(int cpu)
+        {
+#ifdef __linux__
+          if (cpu >= 0 && pthread_getaffinity_np(pthread_self(), sizeof(previous_), &previous_) == 0)
+          {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pinned_ = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+          }
+#else
+          (void)cpu;
+#endif
+        }
+
+        ~CallerPin()
+        {
+#ifdef __linux__
+          if (pinned_)
+          {
+            pthread_setaffinity_np(pthread_self(), sizeof(previous_), &previous_);
+          }
+#endif
+        }
+
+        CallerPin(const CallerPin &) = delete;
+        CallerPin &operator=(const CallerPin &) = delete;
+
+      private:
+#ifdef __linux__
+        cpu_set_t previous_;
+#endif
+        bool pinned_ = false;
+      };
+
+      /// Pool whose task the calling thread is running, if any
+      static ThreadPool *&
+      current()
+      {
+        thread_local ThreadPool *pool = nullptr;
+        return pool;
+      }
+
+      /// Take the first remaining task of share `p` (owner side)
+      bool
+      take_front(unsigned p, std::size_t &task)
+      {
+        std::uint64_t bounds = shares_[p].bounds.load(std::memory_order_relaxed);
+        for (;;)
+        {
+          const std::size_t begin = bounds >> 32;
+          const std::size_t end = bounds & 0xFFFFFFFFu;
+          if (begin >= end)
+          {
+            return false;
+          }
+          if (shares_[p].bounds.compare_exchange_weak(bounds, pack(begin + 1, end), std::memory_order_acquire,
+                                                      std::memory_order_relaxed))
+          {
+            task = begin;
+            return true;
+          }
+        }
+      }
+
+      /// Take the last remaining task of share `p` (thief side)
+      bool
+      take_back(unsigned p, std::size_t &task)
+      {
+        std::uint64_t bounds = shares_[p].bounds.load(std::memory_order_relaxed);
+        for (;;)
+        {
+          const std::size_t begin = bounds >> 32;
+          const std::size_t end = bounds & 0xFFFFFFFFu;
+          if (begin >= end)
+          {
+            return false;
+          }
+          if (shares_[p].bounds.compare_exchange_weak(bounds, pack(begin, end - 1), std::memory_order_acquire,
+                                                      std::memory_order_relaxed))
+          {
+            task = end - 1;
+            return true;
+          }
+        }
+      }
+
+      /// Run own tasks, then steal until every share is empty
+      void
+      participate(unsigned self)
+      {
+        ThreadPool *const previous = current();
+        current() = this;
+        std::size_t task;
+        while (take_front(self, task))
+        {
+          job_.invoke(job_.context, task);
+        }
+        for (unsigned offset = 1; offset < size(); ++offset)
+        {
+          const unsigned victim = (self + offset) % size();
+          while (take_back(victim, task))
+          {
+            job_.invoke(job_.context, task);
+          }
+        }
+        current() = previous;
+      }
+
+      void
+      work(unsigned self)
+      {
+        unsigned seen = 0;
+        for (;;)
+        {
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            detail::wait(wake_, lock, [&] { return generation_ != seen; });
+            seen = generation_;
+            if (stop_)
+            {
+              return;
+            }
+          }
+          participate(self);
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ == 0)
+            {
+              done_.notify_one();
+            }
+          }
+        }
+      }
+
+      std::vector<Share> shares_;
+      std::vector<std::thread> workers_;
+      Job job_;
+      std::mutex submit_mutex_;       ///< One loop at a time
+      std::mutex mutex_;              ///< Guards generation_, busy_, stop_
+      std::condition_variable wake_;
+      std::condition_variable done_;
+      unsigned generation_ = 0;
+      unsigned busy_ = 0;             ///< Workers still in the current loop
+      bool stop_ = false;
+      int caller_cpu_ = -1;           ///< CPU of participant 0 when pinned
+    };
+
+    /**
+     * @brief Pool shared by callers that do not manage their own, with one
+     *        participant per hardware thread, created on first use
+     */
+    inline ThreadPool &
+    default_pool()
+    {
+      static ThreadPool pool;
+      return pool;
+    }
+
+    /**
+     * @brief out[i] = op(in[i]) for i in [0, n), chunked over `pool`
+     * @param op Batch operation, e.g. FastMath::op::exp, or any callable
+     *        (const float *in, float *out, std::size_t n)
+     * @param chunk Elements per task
+     * @note An array of at most one chunk is processed on the calling
+     *       thread without waking the pool.
+     */
+    template <typename Op>
+    inline void
+    transform(ThreadPool &pool, const float *in, float *out, std::size_t n, Op op,
+              std::size_t chunk = default_chunk)
+    {
+      chunk = std::max<std::size_t>(chunk, 1);
+      pool.run((n + chunk - 1) / chunk, [=](std::size_t task) {
+        const std::size_t begin = task * chunk;
+        op(in + begin, out + begin, std::min(chunk, n - begin));
+      });
+    }
+
+    /**
+     * @brief out[i] = op(a[i], b[i]) for i in [0, n), chunked over `pool`
+     * @param op Batch operation, e.g. FastMath::op::atan2
+     */
+    template <typename Op>
+    inline void
+    transform(ThreadPool &pool, const float *a, const float *b, float *out, std::size_t n, Op op,
+              std::size_t chunk = default_chunk)
+    {
+      chunk = std::max<std::size_t>(chunk, 1);
+      pool.run((n + chunk - 1) / chunk, [=](std::size_t task) {
+        const std::size_t begin = task * chunk;
+        op(a + begin, b + begin, out + begin, std::min(chunk, n - begin));
+      });
+    }
+
+    /**
+     * @brief Zero `data` with the same chunking as transform()
+     * @note Call once on freshly allocated, untouched memory (e.g. from
+     *       `new float[n]`, not std::vector, which zeroes on the calling
+     *       thread). On NUMA systems each page is then allocated on the node
+     *       of the participant that later transforms it, as long as the
+     *       same pool, size and chunk are used and the pool is pinned.
+     */
+    inline void
+    first_touch(ThreadPool &pool, float *data, std::size_t n, std::size_t chunk = default_chunk)
+    {
+      chunk = std::max<std::size_t>(chunk, 1);
+      pool.run((n + chunk - 1) / chunk, [=](std::size_t task) {
+        const std::size_t begin = task * chunk;
+        std::fill(data + begin, data + begin + std::min(chunk, n - begin), 0.0f);
+      });
+    }
+  } // namespace parallel
+} // namespace FastMath
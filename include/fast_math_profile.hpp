@@ -0,0 +1,573 @@
+/**
+ * @file fast_math_profile.hpp
+ * @brief Per-function call, branch and input-magnitude counters
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * When the library (or a header-only user) is built with FAST_MATH_PROFILE,
+ * every scalar FastMath call records, for its function, one call, the
+ * special-case path it took (e.g. the `exponent == 2` shortcut in pow or the
+ * std::fmod fallback in fmod) and the binary exponent of its first argument.
+ * Batch calls served by the AVX2/AVX-512 kernels are not counted.
+ *
+ * Counters live in a thread-local block that only its own thread writes, so
+ * recording takes no lock and shares no cache line with other threads.
+ * dump() and the accessors sum the blocks of every live thread plus those of
+ * threads that have already exited. Without FAST_MATH_PROFILE the functions
+ * below still exist but every counter reads zero.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace FastMath
+{
+  namespace profile
+  {
+    /**
+     * @brief Profiled functions; templated precision tiers count under their
+     *        base function
+     */
+    enum class Function
+    {
+      Sin,
+      Cos,
+      Sincos,
+      Tan,
+      Sqrt,
+      Rsqrt,
+      Asin,
+      Acos,
+      Atan,
+      Atan2,
+      Exp,
+      Exp2,
+      Exp10,
+      Expm1,
+      Log,
+      Log10,
+      Log2,
+      Log1p,
+      Pow,
+      Fmod,
+      WrapAngle,
+      Ceil,
+      Floor,
+      Round,
+      Sinh,
+      Cosh,
+      Tanh,
+      Asinh,
+      Acosh,
+      Atanh,
+      Count
+    };
+
+    /**
+     * @brief Special-case paths, each belonging to one function
+     * @note Paths of one function are not necessarily exclusive (tan can
+     *       take both LargeArgument and Pole), so their fractions need not
+     *       sum to one.
+     */
+    enum class Path
+    {
+      SinLargeArgument,
+      CosLargeArgument,
+      SincosLargeArgument,
+      TanLargeArgument,
+      TanPole,
+      SqrtNonPositive,
+      RsqrtTiny,
+      AsinNearOne,
+      AsinOutOfDomain,
+      AcosNearOne,
+      AcosOutOfDomain,
+      AtanReciprocal,
+      Atan2Swapped,
+      Atan2OnAxis,
+      ExpOverflow,
+      ExpUnderflow,
+      Exp2Overflow,
+      Exp2Underflow,
+      Exp10Overflow,
+      Exp10Underflow,
+      Expm1Overflow,
+      Expm1Underflow,
+      LogNonPositive,
+      LogOne,
+      Log10NonPositive,
+      Log2NonPositive,
+      Log1pInvalid,
+      PowZeroExponent,
+      PowUnitExponent,
+      PowZeroBase,
+      PowUnitBase,
+      PowSquare,
+      PowCube,
+      PowFourth,
+      PowSquareRoot,
+      PowReciprocal,
+      PowInverseSquare,
+      PowInteger,
+      PowNegativeBase,
+      PowGeneral,
+      FmodZeroDivisor,
+      FmodSmallDividend,
+      FmodLargeOperand,
+      FmodLargeQuotient,
+      FmodFast,
+      WrapAngleLargeArgument,
+      CeilNegative,
+      FloorNegative,
+      RoundNegative,
+      SinhTaylor,
+      SinhExp,
+      CoshTaylor,
+      CoshExp,
+      TanhTaylor,
+      TanhExp,
+      TanhSaturated,
+      AsinhTaylor,
+      AsinhLog,
+      AcoshInvalid,
+      AcoshTaylor,
+      AcoshLog,
+      AtanhInvalid,
+      AtanhTaylor,
+      AtanhLog,
+      Count
+    };
+
+    /// Bins of the input magnitude histogram, see magnitude_bin()
+    constexpr int magnitude_bins = 66;
+
+    /// Lowest binary exponent with a bin of its own
+    constexpr int min_magnitude_exponent = -32;
+
+    namespace detail
+    {
+      constexpr int function_count = static_cast<int>(Function::Count);
+      constexpr int path_count = static_cast<int>(Path::Count);
+
+      struct PathInfo
+      {
+        Function function;
+        const char *description;
+      };
+
+      constexpr PathInfo paths[path_count] = {
+          {Function::Sin, "|x| > 2^30 (large-argument reduction)"},
+          {Function::Cos, "|x| > 2^30 (large-argument reduction)"},
+          {Function::Sincos, "|x| > 2^30 (large-argument reduction)"},
+          {Function::Tan, "|x| > 2^30 (large-argument reduction)"},
+          {Function::Tan, "|cos x| < 1e-7 (clamped to +-1e7)"},
+          {Function::Sqrt, "x <= 0 (returns 0)"},
+          {Function::Rsqrt, "x < FLT_MIN (returns 1e38)"},
+          {Function::Asin, "|x| > 0.5 (sqrt reduction)"},
+          {Function::Asin, "|x| > 1 (clamped)"},
+          {Function::Acos, "|x| > 0.5 (sqrt reduction)"},
+          {Function::Acos, "|x| > 1 (clamped)"},
+          {Function::Atan, "|x| > 1 (reciprocal ratio)"},
+          {Function::Atan2, "|y| > |x| (swapped ratio)"},
+          {Function::Atan2, "|x| < 1e-7 (axis or origin)"},
+          {Function::Exp, "x > 88 (saturated to 1e38)"},
+          {Function::Exp, "x < -87 (flushed to 0)"},
+          {Function::Exp2, "x > 127 (saturated to 1e38)"},
+          {Function::Exp2, "x < -126 (flushed to 0)"},
+          {Function::Exp10, "x > 38 (saturated to 1e38)"},
+          {Function::Exp10, "x < -37 (flushed to 0)"},
+          {Function::Expm1, "x > 88 (saturated to 1e38)"},
+          {Function::Expm1, "x < -87 (saturated to -1)"},
+          {Function::Log, "x <= 0 (returns -1e38)"},
+          {Function::Log, "x == 1"},
+          {Function::Log10, "x <= 0 (returns -1e38 / ln 10)"},
+          {Function::Log2, "x <= 0 (returns -1e38 / ln 2)"},
+          {Function::Log1p, "x <= -1 (returns -1e38)"},
+          {Function::Pow, "exponent == 0"},
+          {Function::Pow, "exponent == 1"},
+          {Function::Pow, "base == 0"},
+          {Function::Pow, "base == 1"},
+          {Function::Pow, "exponent == 2"},
+          {Function::Pow, "exponent == 3"},
+          {Function::Pow, "exponent == 4"},
+          {Function::Pow, "exponent == 0.5 (sqrt)"},
+          {Function::Pow, "exponent == -1"},
+          {Function::Pow, "exponent == -2"},
+          {Function::Pow, "other integer exponent, |n| <= 32"},
+          {Function::Pow, "negative base, fractional exponent (returns 0)"},
+          {Function::Pow, "exp(exponent * log(base))"},
+          {Function::Fmod, "divisor == 0 (returns 0)"},
+          {Function::Fmod, "|dividend| < |divisor|"},
+          {Function::Fmod, "operand > 25 (std::fmod)"},
+          {Function::Fmod, "|quotient| > 25 (std::fmod)"},
+          {Function::Fmod, "x - trunc(x / y) * y"},
+          {Function::WrapAngle, "|x| > 2^30 (large-argument reduction)"},
+          {Function::Ceil, "x < 0"},
+          {Function::Floor, "x < 0"},
+          {Function::Round, "x < 0"},
+          {Function::Sinh, "|x| < 0.5 (Taylor)"},
+          {Function::Sinh, "exp"},
+          {Function::Cosh, "|x| < 0.5 (Taylor)"},
+          {Function::Cosh, "exp"},
+          {Function::Tanh, "|x| < 0.5 (Taylor)"},
+          {Function::Tanh, "exp"},
+          {Function::Tanh, "|x| > 5 (saturated to +-1)"},
+          {Function::Asinh, "|x| < 0.5 (Taylor)"},
+          {Function::Asinh, "log"},
+          {Function::Acosh, "x < 1 (returns 0)"},
+          {Function::Acosh, "x < 1.5 (Taylor)"},
+          {Function::Acosh, "log"},
+          {Function::Atanh, "|x| >= 1 (returns 0)"},
+          {Function::Atanh, "|x| < 0.5 (Taylor)"},
+          {Function::Atanh, "log"},
+      };
+
+      constexpr const char *function_names[function_count] = {
+          "sin",   "cos",   "sincos", "tan",  "sqrt", "rsqrt", "asin",  "acos", "atan", "atan2",
+          "exp",   "exp2",  "exp10",  "expm1", "log", "log10", "log2",  "log1p", "pow", "fmod",
+          "wrap_angle", "ceil", "floor", "round", "sinh", "cosh", "tanh", "asinh", "acosh", "atanh"};
+
+      /**
+       * @brief One thread's counters
+       * @note Only the owning thread increments them; atomics make the
+       *       concurrent reads in dump() and writes in reset() well defined.
+       */
+      struct Counters
+      {
+        std::atomic<std::uint64_t> calls[function_count] = {};
+        std::atomic<std::uint64_t> paths[path_count] = {};
+        std::atomic<std::uint64_t> magnitudes[function_count][magnitude_bins] = {};
+      };
+
+      inline void
+      increment(std::atomic<std::uint64_t> &counter)
+      {
+        counter.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      /// Blocks of the live threads, and the sum of those that exited
+      struct Registry
+      {
+        std::mutex mutex;
+        std::vector<Counters *> live;
+        Counters retired;
+      };
+
+      inline Registry &
+      registry()
+      {
+        static Registry instance;
+        return instance;
+      }
+
+      /**
+       * @brief Per-thread block, registered on the thread's first call and
+       *        folded into Registry::retired when the thread exits
+       */
+      struct ThreadCounters
+      {
+        Counters counters;
+        int depth = 0; ///< Nesting of profiled calls; only depth 1 records
+
+        ThreadCounters()
+        {
+          Registry &r = registry();
+          std::lock_guard<std::mutex> lock(r.mutex);
+          r.live.push_back(&counters);
+        }
+
+        ~ThreadCounters()
+        {
+          Registry &r = registry();
+          std::lock_guard<std::mutex> lock(r.mutex);
+          for (int f = 0; f < function_count; ++f)
+          {
+            r.retired.calls[f].fetch_add(counters.calls[f].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            for (int b = 0; b < magnitude_bins; ++b)
+            {
+              r.retired.magnitudes[f][b].fetch_add(counters.magnitudes[f][b].load(std::memory_order_relaxed),
+                                                   std::memory_order_relaxed);
+            }
+          }
+          for (int p = 0; p < path_count; ++p)
+          {
+            r.retired.paths[p].fetch_add(counters.paths[p].load(std::memory_order_relaxed), std::memory_order_relaxed);
+          }
+          for (auto it = r.live.begin(); it != r.live.end(); ++it)
+          {
+            if (*it == &counters)
+            {
+              r.live.erase(it);
+              break;
+            }
+          }
+        }
+      };
+
+      inline ThreadCounters &
+      thread_counters()
+      {
+        thread_local ThreadCounters instance;
+        return instance;
+      }
+
+      /// Sum of one counter over every live and retired block
+      template <typename Select>
+      inline std::uint64_t
+      total(Select select)
+      {
+        Registry &r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        std::uint64_t sum = select(r.retired).load(std::memory_order_relaxed);
+        for (Counters *counters : r.live)
+        {
+          sum += select(*counters).load(std::memory_order_relaxed);
+        }
+        return sum;
+      }
+    } // namespace detail
+
+    /// True if the counters are compiled in (FAST_MATH_PROFILE is defined)
+    constexpr bool
+    enabled()
+    {
+#ifdef FAST_MATH_PROFILE
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    inline const char *
+    function_name(Function function)
+    {
+      return detail::function_names[static_cast<int>(function)];
+    }
+
+    /// Function a path belongs to
+    inline Function
+    path_function(Path path)
+    {
+      return detail::paths[static_cast<int>(path)].function;
+    }
+
+    inline const char *
+    path_description(Path path)
+    {
+      return detail::paths[static_cast<int>(path)].description;
+    }
+
+    /**
+     * @brief Histogram bin of |x|
+     * @return 0 for |x| < 2^-32 (including zero and subnormals),
+     *         1 + k + 32 for 2^k <= |x| < 2^(k+1) with k in [-32, 31], and
+     *         magnitude_bins - 1 for |x| >= 2^32, infinities and NaN
+     */
+    inline int
+    magnitude_bin(float x)
+    {
+      std::uint32_t bits;
+      std::memcpy(&bits, &x, sizeof(bits));
+      const int exponent = static_cast<int>((bits >> 23) & 0xFF) - 127;
+      if (exponent < min_magnitude_exponent)
+      {
+        return 0;
+      }
+      if (exponent >= min_magnitude_exponent + magnitude_bins - 2)
+      {
+        return magnitude_bins - 1;
+      }
+      return 1 + exponent - min_magnitude_exponent;
+    }
+
+    /// Outermost calls of `function` on all threads
+    inline std::uint64_t
+    calls(Function function)
+    {
+      const int f = static_cast<int>(function);
+      return detail::total([f](detail::Counters &c) -> std::atomic<std::uint64_t> & { return c.calls[f]; });
+    }
+
+    /// Outermost calls that took `path`
+    inline std::uint64_t
+    path_count(Path path)
+    {
+      const int p = static_cast<int>(path);
+      return detail::total([p](detail::Counters &c) -> std::atomic<std::uint64_t> & { return c.paths[p]; });
+    }
+
+    /// Outermost calls of `function` whose first argument fell in `bin`
+    inline std::uint64_t
+    magnitude_count(Function function, int bin)
+    {
+      const int f = static_cast<int>(function);
+      return detail::total(
+          [f, bin](detail::Counters &c) -> std::atomic<std::uint64_t> & { return c.magnitudes[f][bin]; });
+    }
+
+    /**
+     * @brief Zero every counter
+     * @note Calls that are in flight on other threads may still be counted.
+     */
+    inline void
+    reset()
+    {
+      detail::Registry &r = detail::registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      const auto clear = [](detail::Counters &c) {
+        for (auto &counter : c.calls)
+        {
+          counter.store(0, std::memory_order_relaxed);
+        }
+        for (auto &counter : c.paths)
+        {
+          counter.store(0, std::memory_order_relaxed);
+        }
+        for (auto &row : c.magnitudes)
+        {
+          for (auto &counter : row)
+          {
+            counter.store(0, std::memory_order_relaxed);
+          }
+        }
+      };
+      clear(r.retired);
+      for (detail::Counters *counters : r.live)
+      {
+        clear(*counters);
+      }
+    }
+
+    /**
+     * @brief Print every function that was called: its call count, the
+     *        fraction of calls per path and the non-empty magnitude bins
+     */
+    inline void
+    dump(std::ostream &out)
+    {
+      if (!enabled())
+      {
+        out << "FastMath profile: not compiled in (build with FAST_MATH_PROFILE)\n";
+        return;
+      }
+
+      const auto flags = out.flags();
+      const auto precision = out.precision();
+      out << "FastMath profile\n" << std::fixed << std::setprecision(2);
+      for (int f = 0; f < detail::function_count; ++f)
+      {
+        const Function function = static_cast<Function>(f);
+        const std::uint64_t n = calls(function);
+        if (n == 0)
+        {
+          continue;
+        }
+        out << function_name(function) << ": " << n << " calls\n";
+        for (int p = 0; p < detail::path_count; ++p)
+        {
+          const Path path = static_cast<Path>(p);
+          if (path_function(path) != function)
+          {
+            continue;
+          }
+          const std::uint64_t taken = path_count(path);
+          out << "  " << std::left << std::setw(50) << path_description(path) << std::right << std::setw(12) << taken
+              << std::setw(8) << 100.0 * static_cast<double>(taken) / static_cast<double>(n) << "%\n";
+        }
+        out << "  |x|:";
+        for (int b = 0; b < magnitude_bins; ++b)
+        {
+          const std::uint64_t count = magnitude_count(function, b);
+          if (count == 0)
+          {
+            continue;
+          }
+          if (b == 0)
+          {
+            out << " <2^" << min_magnitude_exponent;
+          }
+          else if (b == magnitude_bins - 1)
+          {
+            out << " >=2^" << min_magnitude_exponent + magnitude_bins - 2;
+          }
+          else
+          {
+            out << " 2^" << b - 1 + min_magnitude_exponent;
+          }
+          out << "=" << count;
+        }
+        out << "\n";
+      }
+      out.flags(flags);
+      out.precision(precision);
+    }
+
+    namespace detail
+    {
+      /**
+       * @brief Counts one call for the duration of a function body
+       * @note Calls made from inside another profiled call (exp inside pow,
+       *       sincos inside tan) are not counted, so every call is attributed
+       *       to the function the user called.
+       */
+      class Scope
+      {
+      public:
+        Scope(Function function, float x) : thread_(thread_counters())
+        {
+          if (thread_.depth++ == 0)
+          {
+            const int f = static_cast<int>(function);
+            increment(thread_.counters.calls[f]);
+            increment(thread_.counters.magnitudes[f][magnitude_bin(x)]);
+          }
+        }
+
+        ~Scope()
+        {
+          --thread_.depth;
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        void
+        record(Path path, bool taken) const
+        {
+          if (taken && thread_.depth == 1)
+          {
+            increment(thread_.counters.paths[static_cast<int>(path)]);
+          }
+        }
+
+      private:
+        ThreadCounters &thread_;
+      };
+    } // namespace detail
+  } // namespace profile
+} // namespace FastMath
+
+// Recording hooks used by fast_math_impl.hpp. FAST_MATH_PROFILE_PATH records
+// `path` if `condition` holds; FAST_MATH_PROFILE_TAKEN records `path` and
+// yields `value`, for use in return statements. Without FAST_MATH_PROFILE
+// they compile to nothing and the condition is not evaluated.
+#ifdef FAST_MATH_PROFILE
+#define FAST_MATH_PROFILE_CALL(function, x)                                                                            \
+  const ::FastMath::profile::detail::Scope fast_math_profile_scope(::FastMath::profile::Function::function, x)
+#define FAST_MATH_PROFILE_PATH(path, condition)                                                                        \
+  fast_math_profile_scope.record(::FastMath::profile::Path::path, condition)
+#define FAST_MATH_PROFILE_TAKEN(path, value) (FAST_MATH_PROFILE_PATH(path, true), value)
+#else
+#define FAST_MATH_PROFILE_CALL(function, x) ((void)0)
+#define FAST_MATH_PROFILE_PATH(path, condition) ((void)0)
+#define FAST_MATH_PROFILE_TAKEN(path, value) (value)
+#endif
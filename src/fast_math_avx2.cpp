@@ -0,0 +1,878 @@
+/**
+ * @file fast_math_avx2.cpp
+ * @brief AVX2/FMA batch kernels (8 lanes)
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ */
+
+#include "fast_math_simd.hpp"
+
+#ifdef FAST_MATH_ENABLE_AVX2
+
+#if !defined(__AVX2__) || !defined(__FMA__)
+#error "fast_math_avx2.cpp must be compiled with -mavx2 -mfma"
+#endif
+
+#include <immintrin.h>
+#include <cstring>
+
+namespace FastMath
+{
+  namespace detail
+  {
+    namespace avx2
+    {
+      namespace
+      {
+        constexpr float pi = 3.14159265358979323846264338327950288f;
+        constexpr float half_pi = pi / 2.0f;
+        constexpr float two_pi = 2.0f * pi;
+
+        inline __m256
+        abs(__m256 x)
+        {
+          return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+        }
+
+        /**
+         * Cody–Waite reduction of 4 lanes in double, as the scalar
+         * detail::reduce_two_pi(): k * two_pi_hi is exact, so the result
+         * keeps float accuracy for |x| up to about 1e9. A float-only
+         * reduction loses the result entirely beyond |x| ~ 1e6. Larger
+         * inputs are clamped into [-π, π] like the scalar version.
+         */
+        inline __m128
+        reduce_two_pi_exact(__m128 x)
+        {
+          const __m256d pi_d = _mm256_set1_pd(3.14159265358979323846);
+          const __m256d wide = _mm256_cvtps_pd(x);
+          const __m256d k = _mm256_round_pd(_mm256_mul_pd(wide, _mm256_set1_pd(0.159154943091895335768883763372514362)),
+                                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+          __m256d r = _mm256_fnmadd_pd(k, _mm256_set1_pd(6.283185958862305), wide);
+          r = _mm256_fnmadd_pd(k, _mm256_set1_pd(-6.516827182105748e-07), r);
+          r = _mm256_min_pd(pi_d, _mm256_max_pd(_mm256_sub_pd(_mm256_setzero_pd(), pi_d), r));
+          return _mm256_cvtpd_ps(r);
+        }
+
+        /**
+         * Range reduction of x into [-π, π], each half in double. With
+         * FAST_MATH_PAYNE_HANEK, lanes above 2^30 are redone exactly by the
+         * scalar Payne–Hanek reduction, as in detail::reduce_two_pi().
+         */
+        inline __m256
+        reduce_two_pi(__m256 x)
+        {
+          __m256 r = _mm256_set_m128(reduce_two_pi_exact(_mm256_extractf128_ps(x, 1)),
+                                     reduce_two_pi_exact(_mm256_castps256_ps128(x)));
+#ifdef FAST_MATH_PAYNE_HANEK
+          const int huge = _mm256_movemask_ps(_mm256_cmp_ps(abs(x), _mm256_set1_ps(1073741824.0f), _CMP_GT_OQ));
+          if (huge != 0)
+          {
+            alignas(32) float lanes[8];
+            alignas(32) float reduced[8];
+            _mm256_store_ps(lanes, x);
+            _mm256_store_ps(reduced, r);
+            for (int i = 0; i < 8; ++i)
+            {
+              if (huge & (1 << i))
+              {
+                reduced[i] = payne_hanek(lanes[i]);
+              }
+            }
+            r = _mm256_load_ps(reduced);
+          }
+#endif
+          return r;
+        }
+
+        /**
+         * Parabola y = B*θ - C*θ*|θ| followed by the weighted correction
+         * y = P * (y*|y| - y) + y with P = 0.225, valid for θ in [-π, π].
+         * Same approximation as the scalar FastMath::sin, without branches.
+         */
+        inline __m256
+        sin_kernel(__m256 theta)
+        {
+          const __m256 B = _mm256_set1_ps(4.0f / pi);
+          const __m256 C = _mm256_set1_ps(4.0f / (pi * pi));
+          const __m256 P = _mm256_set1_ps(0.225f);
+
+          __m256 y = _mm256_mul_ps(B, theta);
+          y = _mm256_fnmadd_ps(_mm256_mul_ps(C, theta), abs(theta), y);
+          __m256 correction = _mm256_fmsub_ps(y, abs(y), y);
+          return _mm256_fmadd_ps(P, correction, y);
+        }
+
+        inline __m256
+        sin_ps(__m256 x)
+        {
+          return sin_kernel(reduce_two_pi(x));
+        }
+
+        /**
+         * cos(x) = sin(x + π/2) for an already reduced x, wrapping the
+         * shifted angle back into [-π, π]
+         */
+        inline __m256
+        cos_reduced(__m256 reduced)
+        {
+          __m256 theta = _mm256_add_ps(reduced, _mm256_set1_ps(half_pi));
+          __m256 wrap = _mm256_cmp_ps(theta, _mm256_set1_ps(pi), _CMP_GT_OQ);
+          theta = _mm256_sub_ps(theta, _mm256_and_ps(wrap, _mm256_set1_ps(two_pi)));
+          return sin_kernel(theta);
+        }
+
+        inline __m256
+        cos_ps(__m256 x)
+        {
+          return cos_reduced(reduce_two_pi(x));
+        }
+
+        /**
+         * asin/acos share one reduction: a = min(|x|, 1); above 0.5 the
+         * polynomial runs on s = sqrt((1 - a) / 2) instead of a. Same
+         * polynomial and selects as the scalar FastMath::asin.
+         */
+        struct AsinReduced
+        {
+          __m256 p;         ///< asin(s) from the polynomial
+          __m256 near_one;  ///< Lane mask for a > 0.5
+          __m256 sign;      ///< Sign bit of x
+        };
+
+        inline AsinReduced
+        asin_reduce(__m256 x)
+        {
+          const __m256 half = _mm256_set1_ps(0.5f);
+          const __m256 a = _mm256_min_ps(abs(x), _mm256_set1_ps(1.0f));
+          AsinReduced r;
+          r.near_one = _mm256_cmp_ps(a, half, _CMP_GT_OQ);
+          r.sign = _mm256_and_ps(x, _mm256_set1_ps(-0.0f));
+
+          const __m256 z_far = _mm256_fnmadd_ps(half, a, half);
+          const __m256 z = _mm256_blendv_ps(_mm256_mul_ps(a, a), z_far, r.near_one);
+          const __m256 s = _mm256_blendv_ps(a, _mm256_sqrt_ps(z_far), r.near_one);
+
+          __m256 p = _mm256_set1_ps(4.2163199048e-2f);
+          p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(2.4181311049e-2f));
+          p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(4.5470025998e-2f));
+          p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(7.4953002686e-2f));
+          p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(1.6666752422e-1f));
+          r.p = _mm256_fmadd_ps(_mm256_mul_ps(s, z), p, s);
+          return r;
+        }
+
+        inline __m256
+        asin_ps(__m256 x)
+        {
+          const AsinReduced r = asin_reduce(x);
+          const __m256 far = _mm256_fnmadd_ps(_mm256_set1_ps(2.0f), r.p, _mm256_set1_ps(half_pi));
+          return _mm256_or_ps(_mm256_blendv_ps(r.p, far, r.near_one), r.sign);
+        }
+
+        inline __m256
+        acos_ps(__m256 x)
+        {
+          // x >= 0: 2p near one, π/2 - p otherwise; x < 0 mirrors around π/2
+          const AsinReduced r = asin_reduce(x);
+          const __m256 two_p = _mm256_add_ps(r.p, r.p);
+          const __m256 signed_p = _mm256_or_ps(r.p, r.sign);
+          const __m256 near = _mm256_blendv_ps(two_p, _mm256_sub_ps(_mm256_set1_ps(pi), two_p), r.sign);
+          const __m256 mid = _mm256_sub_ps(_mm256_set1_ps(half_pi), signed_p);
+          return _mm256_blendv_ps(mid, near, r.near_one);
+        }
+
+        /**
+         * atan(n / d) for 0 <= n <= d, the Precision::Medium polynomial of
+         * the scalar FastMath::atan2
+         */
+        inline __m256
+        atan_octant(__m256 n, __m256 d)
+        {
+          const __m256 t = _mm256_div_ps(n, d);
+          const __m256 z = _mm256_mul_ps(t, t);
+          __m256 q = _mm256_set1_ps(-1.3955098904e-2f);
+          q = _mm256_fmadd_ps(q, z, _mm256_set1_ps(5.8770250113e-2f));
+          q = _mm256_fmadd_ps(q, z, _mm256_set1_ps(-1.2251500929e-1f));
+          q = _mm256_fmadd_ps(q, z, _mm256_set1_ps(1.9618309286e-1f));
+          q = _mm256_fmadd_ps(q, z, _mm256_set1_ps(-3.3308900025e-1f));
+          return _mm256_fmadd_ps(_mm256_mul_ps(t, z), q, t);
+        }
+
+        inline __m256
+        atan_ps(__m256 x)
+        {
+          const __m256 one = _mm256_set1_ps(1.0f);
+          const __m256 a = abs(x);
+          const __m256 swap = _mm256_cmp_ps(a, one, _CMP_GT_OQ);
+          const __m256 angle = atan_octant(_mm256_min_ps(a, one), _mm256_max_ps(a, one));
+          const __m256 folded = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_set1_ps(half_pi), angle), swap);
+          return _mm256_or_ps(folded, _mm256_and_ps(x, _mm256_set1_ps(-0.0f)));
+        }
+
+        inline __m256
+        atan2_ps(__m256 y, __m256 x)
+        {
+          const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+          const __m256 epsilon = _mm256_set1_ps(1e-7f);
+          const __m256 abs_y = abs(y);
+          const __m256 abs_x = abs(x);
+          const __m256 swap = _mm256_cmp_ps(abs_y, abs_x, _CMP_GT_OQ);
+          __m256 angle = atan_octant(_mm256_min_ps(abs_y, abs_x), _mm256_max_ps(abs_y, abs_x));
+          angle = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_set1_ps(half_pi), angle), swap);
+          angle = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_set1_ps(pi), angle), x);
+
+          // Same special cases as the scalar version: the y axis for
+          // |x| < 1e-7, 0 at the origin. y < 0 (sign bit) negates.
+          const __m256 on_axis = _mm256_cmp_ps(abs_x, epsilon, _CMP_LT_OQ);
+          const __m256 at_origin = _mm256_and_ps(on_axis, _mm256_cmp_ps(abs_y, epsilon, _CMP_LT_OQ));
+          angle = _mm256_blendv_ps(angle, _mm256_set1_ps(half_pi), on_axis);
+          angle = _mm256_andnot_ps(at_origin, angle);
+          const __m256 negative = _mm256_andnot_ps(at_origin, _mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_LT_OQ));
+          return _mm256_xor_ps(angle, _mm256_and_ps(negative, sign_mask));
+        }
+
+        /**
+         * x wrapped into [-π, π): float(π) is above π, so a result rounded
+         * up to it moves to -float(π), exactly
+         */
+        inline __m256
+        wrap_angle_ps(__m256 x)
+        {
+          const __m256 r = reduce_two_pi(x);
+          const __m256 upper = _mm256_cmp_ps(r, _mm256_set1_ps(pi), _CMP_GE_OQ);
+          return _mm256_sub_ps(r, _mm256_and_ps(upper, _mm256_set1_ps(two_pi)));
+        }
+
+        /// Same limit as detail::reciprocal_quotient_limit (2^21)
+        constexpr float reciprocal_quotient_limit = 2097152.0f;
+
+        /**
+         * fmod by d > 0 as the scalar detail::fmod_reciprocal(): q is the
+         * rounded quotient, the FMA gives the exact |x| - q * d, and lanes
+         * at or above the quotient limit pass x through unchanged
+         */
+        inline __m256
+        fmod_reciprocal_ps(__m256 x, __m256 d, __m256 inverse)
+        {
+          const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+          const __m256 ax = abs(x);
+          const __m256 t = _mm256_mul_ps(ax, inverse);
+          const __m256 large = _mm256_cmp_ps(t, _mm256_set1_ps(reciprocal_quotient_limit), _CMP_GE_OQ);
+          const __m256 q = _mm256_round_ps(_mm256_andnot_ps(large, t), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+          __m256 r = _mm256_fnmadd_ps(q, d, ax);
+          r = _mm256_add_ps(r, _mm256_and_ps(_mm256_cmp_ps(r, _mm256_setzero_ps(), _CMP_LT_OQ), d));
+          r = _mm256_or_ps(r, _mm256_and_ps(x, sign_mask));
+          return _mm256_blendv_ps(r, x, large);
+        }
+
+        constexpr float inv_ln2 = 1.44269504088896341f;  // 1/ln(2)
+        constexpr float inv_ln10 = 0.43429448190325176f; // 1/ln(10)
+        // ln(2) split into a head with trailing zero bits and a tail,
+        // so that x - n*ln(2) is exact for every representable n
+        constexpr float ln2_hi = 0.693359375f;
+        constexpr float ln2_lo = -2.12194440e-4f;
+        constexpr float ln2 = 0.69314718055994531f;
+        constexpr float log2_10 = 3.32192809488736235f; // log2(10)
+        constexpr float log10_2 = 0.30102999566398120f; // log10(2)
+        // ln(10) as a float head and the remaining tail
+        constexpr float ln10 = 2.30258512496948242f;
+        constexpr float ln10_lo = -3.19754367e-8f;
+        constexpr float sqrt2 = 1.41421356237309505f;
+
+        /**
+         * e^r - 1 for r in [-ln(2)/2, ln(2)/2], the 5th order polynomial of
+         * the scalar FastMath::exp without its constant term
+         */
+        inline __m256
+        expm1_poly_ps(__m256 r)
+        {
+          __m256 poly = _mm256_set1_ps(1.0f / 120.0f);
+          poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(1.0f / 24.0f));
+          poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(1.0f / 6.0f));
+          poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(0.5f));
+          poly = _mm256_fmadd_ps(poly, r, _mm256_set1_ps(1.0f));
+          return _mm256_mul_ps(poly, r);
+        }
+
+        /**
+         * Range reduction shared by the exp family: n = round(fx), where fx
+         * is x scaled to base 2, and r = x - n*ln(2) in Cody-Waite form
+         */
+        inline __m256
+        exp_round(__m256 fx)
+        {
+          return _mm256_round_ps(fx, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        inline __m256
+        exp_reduce(__m256 x, __m256 n)
+        {
+          __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(ln2_hi), x);
+          return _mm256_fnmadd_ps(n, _mm256_set1_ps(ln2_lo), r);
+        }
+
+        /**
+         * 2^n built in the exponent field (AVX2 has no vscalefps). n is
+         * clamped to the normal exponents; lanes beyond them are saturated
+         * by the callers.
+         */
+        inline __m256
+        pow2n(__m256 n)
+        {
+          n = _mm256_min_ps(_mm256_set1_ps(127.0f), _mm256_max_ps(_mm256_set1_ps(-126.0f), n));
+          const __m256i biased = _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127));
+          return _mm256_castsi256_ps(_mm256_slli_epi32(biased, 23));
+        }
+
+        /**
+         * 2^n * e^r with the saturation of the scalar versions: `overflow`
+         * lanes give 1e38, `underflow` lanes 0
+         */
+        inline __m256
+        exp_finish(__m256 r, __m256 n, __m256 overflow, __m256 underflow)
+        {
+          __m256 poly = _mm256_add_ps(expm1_poly_ps(r), _mm256_set1_ps(1.0f));
+          __m256 result = _mm256_mul_ps(poly, pow2n(n));
+          result = _mm256_blendv_ps(result, _mm256_set1_ps(1e38f), overflow);
+          return _mm256_andnot_ps(underflow, result);
+        }
+
+        /**
+         * exp(x) = 2^n * exp(r), r = x - n*ln(2) in [-ln(2)/2, ln(2)/2], with
+         * the 5th order polynomial of the scalar FastMath::exp
+         */
+        inline __m256
+        exp_ps(__m256 x)
+        {
+          __m256 n = exp_round(_mm256_mul_ps(x, _mm256_set1_ps(inv_ln2)));
+          __m256 r = exp_reduce(x, n);
+          return exp_finish(r, n, _mm256_cmp_ps(x, _mm256_set1_ps(88.0f), _CMP_GT_OQ),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(-87.0f), _CMP_LT_OQ));
+        }
+
+        inline __m256
+        exp2_ps(__m256 x)
+        {
+          // x - n is exact, so the only rounding is the scaling by ln(2)
+          __m256 n = exp_round(x);
+          __m256 r = _mm256_mul_ps(_mm256_sub_ps(x, n), _mm256_set1_ps(ln2));
+          return exp_finish(r, n, _mm256_cmp_ps(x, _mm256_set1_ps(127.0f), _CMP_GT_OQ),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(-126.0f), _CMP_LT_OQ));
+        }
+
+        inline __m256
+        exp10_ps(__m256 x)
+        {
+          // r = x*ln(10) - n*ln(2): the head is formed by one FMA around the
+          // exact n*ln2_hi, the tails of both constants are added after
+          __m256 n = exp_round(_mm256_mul_ps(x, _mm256_set1_ps(log2_10)));
+          __m256 r = _mm256_fmadd_ps(x, _mm256_set1_ps(ln10), _mm256_mul_ps(n, _mm256_set1_ps(-ln2_hi)));
+          r = _mm256_fnmadd_ps(n, _mm256_set1_ps(ln2_lo), r);
+          r = _mm256_fmadd_ps(x, _mm256_set1_ps(ln10_lo), r);
+          return exp_finish(r, n, _mm256_cmp_ps(x, _mm256_set1_ps(38.0f), _CMP_GT_OQ),
+                            _mm256_cmp_ps(x, _mm256_set1_ps(-37.0f), _CMP_LT_OQ));
+        }
+
+        inline __m256
+        expm1_ps(__m256 x)
+        {
+          // 2^n * (e^r - 1) + (2^n - 1); n = 0 leaves the polynomial alone
+          __m256 n = exp_round(_mm256_mul_ps(x, _mm256_set1_ps(inv_ln2)));
+          __m256 r = exp_reduce(x, n);
+          const __m256 one = _mm256_set1_ps(1.0f);
+          __m256 scale = pow2n(n);
+          __m256 result = _mm256_fmadd_ps(scale, expm1_poly_ps(r), _mm256_sub_ps(scale, one));
+          result = _mm256_blendv_ps(result, _mm256_set1_ps(1e38f), _mm256_cmp_ps(x, _mm256_set1_ps(88.0f), _CMP_GT_OQ));
+          return _mm256_blendv_ps(result, _mm256_set1_ps(-1.0f), _mm256_cmp_ps(x, _mm256_set1_ps(-87.0f), _CMP_LT_OQ));
+        }
+
+        /**
+         * atanh series of the scalar FastMath::log on a mantissa,
+         * log(m) = 2t(1 + t²/3 + ...), t = (m - 1) / (m + 1)
+         */
+        inline __m256
+        log_series_ps(__m256 mantissa)
+        {
+          const __m256 one = _mm256_set1_ps(1.0f);
+          __m256 t = _mm256_div_ps(_mm256_sub_ps(mantissa, one), _mm256_add_ps(mantissa, one));
+          __m256 t2 = _mm256_mul_ps(t, t);
+
+          __m256 poly = _mm256_set1_ps(2.0f / 9.0f);
+          poly = _mm256_fmadd_ps(poly, t2, _mm256_set1_ps(2.0f / 7.0f));
+          poly = _mm256_fmadd_ps(poly, t2, _mm256_set1_ps(2.0f / 5.0f));
+          poly = _mm256_fmadd_ps(poly, t2, _mm256_set1_ps(2.0f / 3.0f));
+          poly = _mm256_fmadd_ps(poly, t2, _mm256_set1_ps(2.0f));
+          return _mm256_mul_ps(poly, t);
+        }
+
+        /**
+         * Splits x into exponent and mantissa in [1, 2) on the bits, as the
+         * scalar detail::log_reduce() (AVX2 has no vgetexpps / vgetmantps)
+         */
+        inline __m256
+        log_split(__m256 x, __m256 &exponent)
+        {
+          const __m256i biased = _mm256_srli_epi32(_mm256_castps_si256(x), 23);
+          exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(biased, _mm256_set1_epi32(127)));
+          const __m256 fraction = _mm256_castsi256_ps(_mm256_set1_epi32(0x007FFFFF));
+          return _mm256_or_ps(_mm256_and_ps(x, fraction), _mm256_set1_ps(1.0f));
+        }
+
+        /**
+         * Evaluates the atanh series of the scalar FastMath::log on the
+         * mantissa of x. Returns log(mantissa); the exponent is written to
+         * `exponent`.
+         */
+        inline __m256
+        log_mantissa_ps(__m256 x, __m256 &exponent)
+        {
+          return log_series_ps(log_split(x, exponent));
+        }
+
+        /**
+         * As log_mantissa_ps, with the mantissa centred on 1 ([√½, √2)) like
+         * the scalar log2, log10 and log1p
+         */
+        inline __m256
+        log_mantissa_centred_ps(__m256 x, __m256 &exponent)
+        {
+          __m256 mantissa = log_split(x, exponent);
+          const __m256 upper = _mm256_cmp_ps(mantissa, _mm256_set1_ps(sqrt2), _CMP_GT_OQ);
+          mantissa = _mm256_blendv_ps(mantissa, _mm256_mul_ps(mantissa, _mm256_set1_ps(0.5f)), upper);
+          exponent = _mm256_add_ps(exponent, _mm256_and_ps(upper, _mm256_set1_ps(1.0f)));
+          return log_series_ps(mantissa);
+        }
+
+        /**
+         * Invalid input (x <= 0) maps to `invalid_value` (-1e38 for log), as
+         * in the scalar version
+         */
+        inline __m256
+        log_invalid(__m256 x, __m256 result, float invalid_value = -1e38f)
+        {
+          const __m256 invalid = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LE_OQ);
+          return _mm256_blendv_ps(result, _mm256_set1_ps(invalid_value), invalid);
+        }
+
+        inline __m256
+        log_ps(__m256 x)
+        {
+          __m256 exponent;
+          __m256 poly = log_mantissa_ps(x, exponent);
+          return log_invalid(x, _mm256_fmadd_ps(exponent, _mm256_set1_ps(ln2), poly));
+        }
+
+        inline __m256
+        log2_ps(__m256 x)
+        {
+          // The exponent is already base 2, so only the mantissa term is scaled
+          __m256 exponent;
+          __m256 poly = log_mantissa_centred_ps(x, exponent);
+          return log_invalid(x, _mm256_fmadd_ps(poly, _mm256_set1_ps(inv_ln2), exponent), -1e38f * inv_ln2);
+        }
+
+        inline __m256
+        log10_ps(__m256 x)
+        {
+          __m256 exponent;
+          __m256 poly = log_mantissa_centred_ps(x, exponent);
+          __m256 result = _mm256_fmadd_ps(exponent, _mm256_set1_ps(log10_2), _mm256_mul_ps(poly, _mm256_set1_ps(inv_ln10)));
+          return log_invalid(x, result, -1e38f * inv_ln10);
+        }
+
+        inline __m256
+        log1p_ps(__m256 x)
+        {
+          // u = 1 + x, plus its rounding error (x - (u - 1)) / u
+          const __m256 one = _mm256_set1_ps(1.0f);
+          // (the FMA keeps -ffast-math from folding x - (u - 1) to 0)
+          __m256 u = _mm256_add_ps(x, one);
+          __m256 correction = _mm256_div_ps(_mm256_sub_ps(x, _mm256_fmsub_ps(u, one, one)), u);
+
+          __m256 exponent;
+          __m256 poly = _mm256_add_ps(log_mantissa_centred_ps(u, exponent), correction);
+          __m256 result = _mm256_fmadd_ps(exponent, _mm256_set1_ps(ln2_lo), poly);
+          result = _mm256_fmadd_ps(exponent, _mm256_set1_ps(ln2_hi), result);
+          const __m256 invalid = _mm256_cmp_ps(x, _mm256_set1_ps(-1.0f), _CMP_LE_OQ);
+          return _mm256_blendv_ps(result, _mm256_set1_ps(-1e38f), invalid);
+        }
+
+        /**
+         * 1/x in double: under -ffast-math GCC turns a float vector division
+         * into rcpps plus a Newton step, which is inexact and NaN for 0 and inf
+         */
+        inline __m256
+        reciprocal_exact(__m256 x)
+        {
+          const __m256d one = _mm256_set1_pd(1.0);
+          const __m128 low = _mm256_cvtpd_ps(_mm256_div_pd(one, _mm256_cvtps_pd(_mm256_castps256_ps128(x))));
+          const __m128 high = _mm256_cvtpd_ps(_mm256_div_pd(one, _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1))));
+          return _mm256_set_m128(high, low);
+        }
+
+        /**
+         * base^exponent with the special cases of the scalar FastMath::pow.
+         * Integer exponents with |n| <= 32 use branch-free binary
+         * exponentiation; all other lanes use exp(exponent * log(base)).
+         */
+        inline __m256
+        pow_ps(__m256 base, __m256 exponent)
+        {
+          const __m256 zero = _mm256_setzero_ps();
+          const __m256 one = _mm256_set1_ps(1.0f);
+          const __m256 abs_base = abs(base);
+
+          // General case: exp(exponent * log(|base|)); negative base is invalid
+          __m256 result = exp_ps(_mm256_mul_ps(exponent, log_ps(abs_base)));
+          result = _mm256_andnot_ps(_mm256_cmp_ps(base, zero, _CMP_LT_OQ), result);
+
+          // Integer exponents; the unsigned compare keeps the INT32_MIN of an
+          // out-of-range conversion from counting as small
+          const __m256i int_exp = _mm256_cvttps_epi32(exponent);
+          const __m256i abs_exp = _mm256_abs_epi32(int_exp);
+          const __m256i small = _mm256_cmpeq_epi32(_mm256_min_epu32(abs_exp, _mm256_set1_epi32(32)), abs_exp);
+          const __m256 is_int = _mm256_and_ps(_mm256_cmp_ps(exponent, _mm256_cvtepi32_ps(int_exp), _CMP_EQ_OQ),
+                                              _mm256_castsi256_ps(small));
+
+          // vblendvps selects on the sign bit, so each exponent bit is
+          // shifted up to it
+          __m256 int_result = one;
+          __m256 power = abs_base;
+          __m256i bits = abs_exp;
+          for (int i = 0; i < 6; ++i)
+          {
+            const __m256 bit = _mm256_castsi256_ps(_mm256_slli_epi32(bits, 31));
+            int_result = _mm256_blendv_ps(int_result, _mm256_mul_ps(int_result, power), bit);
+            power = _mm256_mul_ps(power, power);
+            bits = _mm256_srli_epi32(bits, 1);
+          }
+          const __m256 negative_exp = _mm256_castsi256_ps(int_exp);
+          int_result = _mm256_blendv_ps(int_result, reciprocal_exact(int_result), negative_exp);
+          // Odd integer exponent keeps the sign of the base
+          const __m256 odd = _mm256_castsi256_ps(_mm256_slli_epi32(int_exp, 31));
+          int_result = _mm256_xor_ps(int_result, _mm256_and_ps(base, odd));
+          result = _mm256_blendv_ps(result, int_result, is_int);
+
+          // Special cases, lowest priority first
+          result = _mm256_blendv_ps(result, one, _mm256_cmp_ps(base, one, _CMP_EQ_OQ));
+          const __m256 zero_base = _mm256_cmp_ps(base, zero, _CMP_EQ_OQ);
+          const __m256 positive_exp = _mm256_cmp_ps(exponent, zero, _CMP_GT_OQ);
+          result = _mm256_blendv_ps(result, zero, _mm256_and_ps(zero_base, positive_exp));
+          result = _mm256_blendv_ps(result, _mm256_set1_ps(1e38f), _mm256_andnot_ps(positive_exp, zero_base));
+          result = _mm256_blendv_ps(result, base, _mm256_cmp_ps(exponent, one, _CMP_EQ_OQ));
+          return _mm256_blendv_ps(result, one, _mm256_cmp_ps(exponent, zero, _CMP_EQ_OQ));
+        }
+
+        constexpr float min_normal = 1.17549435e-38f; // FLT_MIN
+        constexpr float max_float = 3.40282347e+38f;  // FLT_MAX
+
+        /**
+         * vrsqrtps estimate (12 bits) refined by the Newton-Raphson step of
+         * the scalar FastMath::rsqrt, y + y/2 * (1 - x*y*y) with x*y formed
+         * first; the FMAs keep -ffast-math from regrouping it
+         */
+        inline __m256
+        rsqrt_estimate(__m256 x)
+        {
+          const __m256 y = _mm256_rsqrt_ps(x);
+          const __m256 e = _mm256_fnmadd_ps(_mm256_mul_ps(x, y), y, _mm256_set1_ps(1.0f));
+          return _mm256_fmadd_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), e, y);
+        }
+
+        inline __m256
+        rsqrt_ps(__m256 x)
+        {
+          const __m256 tiny = _mm256_cmp_ps(x, _mm256_set1_ps(min_normal), _CMP_LT_OQ);
+          return _mm256_blendv_ps(rsqrt_estimate(x), _mm256_set1_ps(1e38f), tiny);
+        }
+
+        /**
+         * sqrt(x) = x * rsqrt(x), refined with one Newton-Raphson step on
+         * the root itself; faster than vsqrtps (which is not pipelined on
+         * most cores) and within 2.6 ulp (12-bit estimate). Lanes below
+         * FLT_MIN give 0; +inf, where x * rsqrt(x) is inf * 0, passes through.
+         */
+        inline __m256
+        sqrt_ps(__m256 x)
+        {
+          const __m256 y = _mm256_rsqrt_ps(x);
+          const __m256 s = _mm256_mul_ps(x, y);
+          const __m256 h = _mm256_mul_ps(_mm256_set1_ps(0.5f), y);
+          const __m256 r = _mm256_fnmadd_ps(s, h, _mm256_set1_ps(0.5f));
+          const __m256 valid = _mm256_cmp_ps(x, _mm256_set1_ps(min_normal), _CMP_GE_OQ);
+          const __m256 infinite = _mm256_cmp_ps(x, _mm256_set1_ps(max_float), _CMP_GT_OQ);
+          return _mm256_blendv_ps(_mm256_and_ps(_mm256_fmadd_ps(s, r, s), valid), x, infinite);
+        }
+
+        /**
+         * 1/|v| from the squared length, 0 below FLT_MIN (where the
+         * estimate would be inf or NaN)
+         */
+        inline __m256
+        inverse_length(__m256 length_squared)
+        {
+          const __m256 valid = _mm256_cmp_ps(length_squared, _mm256_set1_ps(min_normal), _CMP_GE_OQ);
+          return _mm256_and_ps(rsqrt_estimate(length_squared), valid);
+        }
+
+        /**
+         * Lanes [0, count) set, for vmaskmovps on the last partial block
+         */
+        inline __m256i
+        tail_mask(std::size_t count)
+        {
+          return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(count)),
+                                    _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        }
+
+        /**
+         * Applies an 8-lane kernel over a buffer. The remainder is staged
+         * through a zero-padded stack block so that every element goes
+         * through the same vector code path.
+         */
+        template <typename Kernel>
+        inline void
+        transform(const float *in, float *out, std::size_t n, Kernel kernel)
+        {
+          std::size_t i = 0;
+          for (; i + 16 <= n; i += 16)
+          {
+            __m256 a = _mm256_loadu_ps(in + i);
+            __m256 b = _mm256_loadu_ps(in + i + 8);
+            _mm256_storeu_ps(out + i, kernel(a));
+            _mm256_storeu_ps(out + i + 8, kernel(b));
+          }
+          for (; i + 8 <= n; i += 8)
+          {
+            _mm256_storeu_ps(out + i, kernel(_mm256_loadu_ps(in + i)));
+          }
+          if (i < n)
+          {
+            alignas(32) float block[8] = {};
+            std::memcpy(block, in + i, (n - i) * sizeof(float));
+            _mm256_store_ps(block, kernel(_mm256_load_ps(block)));
+            std::memcpy(out + i, block, (n - i) * sizeof(float));
+          }
+        }
+
+        /**
+         * Two-input variant of transform()
+         */
+        template <typename Kernel>
+        inline void
+        transform(const float *a, const float *b, float *out, std::size_t n, Kernel kernel)
+        {
+          std::size_t i = 0;
+          for (; i + 8 <= n; i += 8)
+          {
+            _mm256_storeu_ps(out + i, kernel(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+          }
+          if (i < n)
+          {
+            alignas(32) float block_a[8] = {};
+            alignas(32) float block_b[8] = {};
+            std::memcpy(block_a, a + i, (n - i) * sizeof(float));
+            std::memcpy(block_b, b + i, (n - i) * sizeof(float));
+            _mm256_store_ps(block_a, kernel(_mm256_load_ps(block_a), _mm256_load_ps(block_b)));
+            std::memcpy(out + i, block_a, (n - i) * sizeof(float));
+          }
+        }
+      } // namespace
+
+      void
+      sin(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, sin_ps);
+      }
+
+      void
+      cos(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, cos_ps);
+      }
+
+      void
+      asin(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, asin_ps);
+      }
+
+      void
+      acos(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, acos_ps);
+      }
+
+      void
+      atan(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, atan_ps);
+      }
+
+      void
+      atan2(const float *y, const float *x, float *out, std::size_t n)
+      {
+        transform(y, x, out, n, atan2_ps);
+      }
+
+      void
+      fmod_reciprocal(const float *in, float *out, std::size_t n, float divisor, float inverse)
+      {
+        const __m256 d = _mm256_set1_ps(divisor);
+        const __m256 inv = _mm256_set1_ps(inverse);
+        transform(in, out, n, [d, inv](__m256 x) { return fmod_reciprocal_ps(x, d, inv); });
+      }
+
+      void
+      wrap_angle(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, wrap_angle_ps);
+      }
+
+      void
+      exp(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, exp_ps);
+      }
+
+      void
+      exp2(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, exp2_ps);
+      }
+
+      void
+      exp10(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, exp10_ps);
+      }
+
+      void
+      expm1(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, expm1_ps);
+      }
+
+      void
+      log(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log_ps);
+      }
+
+      void
+      log2(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log2_ps);
+      }
+
+      void
+      log10(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log10_ps);
+      }
+
+      void
+      log1p(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log1p_ps);
+      }
+
+      void
+      pow(const float *base, const float *exponent, float *out, std::size_t n)
+      {
+        transform(base, exponent, out, n, pow_ps);
+      }
+
+      void
+      sqrt(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, sqrt_ps);
+      }
+
+      void
+      rsqrt(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, rsqrt_ps);
+      }
+
+      void
+      normalize2(const float *x, const float *y, float *out_x, float *out_y, std::size_t n)
+      {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          const __m256 vx = _mm256_loadu_ps(x + i);
+          const __m256 vy = _mm256_loadu_ps(y + i);
+          const __m256 scale = inverse_length(_mm256_fmadd_ps(vx, vx, _mm256_mul_ps(vy, vy)));
+          _mm256_storeu_ps(out_x + i, _mm256_mul_ps(vx, scale));
+          _mm256_storeu_ps(out_y + i, _mm256_mul_ps(vy, scale));
+        }
+        if (i < n)
+        {
+          const __m256i mask = tail_mask(n - i);
+          const __m256 vx = _mm256_maskload_ps(x + i, mask);
+          const __m256 vy = _mm256_maskload_ps(y + i, mask);
+          const __m256 scale = inverse_length(_mm256_fmadd_ps(vx, vx, _mm256_mul_ps(vy, vy)));
+          _mm256_maskstore_ps(out_x + i, mask, _mm256_mul_ps(vx, scale));
+          _mm256_maskstore_ps(out_y + i, mask, _mm256_mul_ps(vy, scale));
+        }
+      }
+
+      void
+      normalize3(const float *x, const float *y, const float *z, float *out_x, float *out_y, float *out_z,
+                 std::size_t n)
+      {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          const __m256 vx = _mm256_loadu_ps(x + i);
+          const __m256 vy = _mm256_loadu_ps(y + i);
+          const __m256 vz = _mm256_loadu_ps(z + i);
+          const __m256 length_squared = _mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vz, vz)));
+          const __m256 scale = inverse_length(length_squared);
+          _mm256_storeu_ps(out_x + i, _mm256_mul_ps(vx, scale));
+          _mm256_storeu_ps(out_y + i, _mm256_mul_ps(vy, scale));
+          _mm256_storeu_ps(out_z + i, _mm256_mul_ps(vz, scale));
+        }
+        if (i < n)
+        {
+          const __m256i mask = tail_mask(n - i);
+          const __m256 vx = _mm256_maskload_ps(x + i, mask);
+          const __m256 vy = _mm256_maskload_ps(y + i, mask);
+          const __m256 vz = _mm256_maskload_ps(z + i, mask);
+          const __m256 length_squared = _mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vz, vz)));
+          const __m256 scale = inverse_length(length_squared);
+          _mm256_maskstore_ps(out_x + i, mask, _mm256_mul_ps(vx, scale));
+          _mm256_maskstore_ps(out_y + i, mask, _mm256_mul_ps(vy, scale));
+          _mm256_maskstore_ps(out_z + i, mask, _mm256_mul_ps(vz, scale));
+        }
+      }
+
+      void
+      sincos(const float *in, float *sin_out, float *cos_out, std::size_t n)
+      {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+          __m256 reduced = reduce_two_pi(_mm256_loadu_ps(in + i));
+          _mm256_storeu_ps(sin_out + i, sin_kernel(reduced));
+          _mm256_storeu_ps(cos_out + i, cos_reduced(reduced));
+        }
+        if (i < n)
+        {
+          alignas(32) float block[8] = {};
+          std::memcpy(block, in + i, (n - i) * sizeof(float));
+          __m256 reduced = reduce_two_pi(_mm256_load_ps(block));
+          _mm256_store_ps(block, sin_kernel(reduced));
+          std::memcpy(sin_out + i, block, (n - i) * sizeof(float));
+          _mm256_store_ps(block, cos_reduced(reduced));
+          std::memcpy(cos_out + i, block, (n - i) * sizeof(float));
+        }
+      }
+    } // namespace avx2
+  } // namespace detail
+} // namespace FastMath
+
+#endif // FAST_MATH_ENABLE_AVX2
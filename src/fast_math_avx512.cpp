@@ -0,0 +1,508 @@
+/**
+ * @file fast_math_avx512.cpp
+ * @brief AVX-512 batch kernels (16 lanes)
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ */
+
+#include "fast_math_simd.hpp"
+
+#ifdef FAST_MATH_ENABLE_AVX512
+
+#if !defined(__AVX512F__) || !defined(__FMA__)
+#error "fast_math_avx512.cpp must be compiled with -mavx512f -mavx2 -mfma"
+#endif
+
+// GCC 12's avx512fintrin.h seeds results with _mm512_undefined_*(), which
+// trips -Wmaybe-uninitialized at -O3 (GCC PR 105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <immintrin.h>
+#include <cstdint>
+
+namespace FastMath
+{
+  namespace detail
+  {
+    namespace avx512
+    {
+      namespace
+      {
+        constexpr float inv_ln2 = 1.44269504088896341f;  // 1/ln(2)
+        constexpr float inv_ln10 = 0.43429448190325176f; // 1/ln(10)
+        // ln(2) split into a head with trailing zero bits and a tail,
+        // so that x - n*ln(2) is exact for every representable n
+        constexpr float ln2_hi = 0.693359375f;
+        constexpr float ln2_lo = -2.12194440e-4f;
+        constexpr float ln2 = 0.69314718055994531f;
+        constexpr float log2_10 = 3.32192809488736235f; // log2(10)
+        constexpr float log10_2 = 0.30102999566398120f; // log10(2)
+        // ln(10) as a float head and the remaining tail
+        constexpr float ln10 = 2.30258512496948242f;
+        constexpr float ln10_lo = -3.19754367e-8f;
+        constexpr float sqrt2 = 1.41421356237309505f;
+
+        /**
+         * e^r - 1 for r in [-ln(2)/2, ln(2)/2], the 5th order polynomial of
+         * the scalar FastMath::exp without its constant term
+         */
+        inline __m512
+        expm1_poly_ps(__m512 r)
+        {
+          __m512 poly = _mm512_set1_ps(1.0f / 120.0f);
+          poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(1.0f / 24.0f));
+          poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(1.0f / 6.0f));
+          poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(0.5f));
+          poly = _mm512_fmadd_ps(poly, r, _mm512_set1_ps(1.0f));
+          return _mm512_mul_ps(poly, r);
+        }
+
+        /**
+         * Range reduction shared by the exp family: n = round(fx), where fx
+         * is x scaled to base 2, and r = x - n*ln(2) in Cody-Waite form
+         */
+        inline __m512
+        exp_round(__m512 fx)
+        {
+          return _mm512_roundscale_ps(fx, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+        inline __m512
+        exp_reduce(__m512 x, __m512 n)
+        {
+          __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(ln2_hi), x);
+          return _mm512_fnmadd_ps(n, _mm512_set1_ps(ln2_lo), r);
+        }
+
+        /**
+         * 2^n * e^r with the saturation of the scalar versions: `overflow`
+         * lanes give 1e38, `underflow` lanes 0
+         */
+        inline __m512
+        exp_finish(__m512 r, __m512 n, __mmask16 overflow, __mmask16 underflow)
+        {
+          __m512 poly = _mm512_add_ps(expm1_poly_ps(r), _mm512_set1_ps(1.0f));
+          __m512 result = _mm512_scalef_ps(poly, n);
+          result = _mm512_mask_mov_ps(result, overflow, _mm512_set1_ps(1e38f));
+          return _mm512_mask_mov_ps(result, underflow, _mm512_setzero_ps());
+        }
+
+        /**
+         * exp(x) = 2^n * exp(r), r = x - n*ln(2) in [-ln(2)/2, ln(2)/2].
+         * exp(r) uses the same 5th order polynomial as the scalar FastMath::exp;
+         * 2^n is applied with vscalefps instead of building the exponent bits.
+         */
+        inline __m512
+        exp_ps(__m512 x)
+        {
+          __m512 n = exp_round(_mm512_mul_ps(x, _mm512_set1_ps(inv_ln2)));
+          __m512 r = exp_reduce(x, n);
+          return exp_finish(r, n, _mm512_cmp_ps_mask(x, _mm512_set1_ps(88.0f), _CMP_GT_OQ),
+                            _mm512_cmp_ps_mask(x, _mm512_set1_ps(-87.0f), _CMP_LT_OQ));
+        }
+
+        inline __m512
+        exp2_ps(__m512 x)
+        {
+          // x - n is exact, so the only rounding is the scaling by ln(2)
+          __m512 n = exp_round(x);
+          __m512 r = _mm512_mul_ps(_mm512_sub_ps(x, n), _mm512_set1_ps(ln2));
+          return exp_finish(r, n, _mm512_cmp_ps_mask(x, _mm512_set1_ps(127.0f), _CMP_GT_OQ),
+                            _mm512_cmp_ps_mask(x, _mm512_set1_ps(-126.0f), _CMP_LT_OQ));
+        }
+
+        inline __m512
+        exp10_ps(__m512 x)
+        {
+          // r = x*ln(10) - n*ln(2): the head is formed by one FMA around the
+          // exact n*ln2_hi, the tails of both constants are added after
+          __m512 n = exp_round(_mm512_mul_ps(x, _mm512_set1_ps(log2_10)));
+          __m512 r = _mm512_fmadd_ps(x, _mm512_set1_ps(ln10), _mm512_mul_ps(n, _mm512_set1_ps(-ln2_hi)));
+          r = _mm512_fnmadd_ps(n, _mm512_set1_ps(ln2_lo), r);
+          r = _mm512_fmadd_ps(x, _mm512_set1_ps(ln10_lo), r);
+          return exp_finish(r, n, _mm512_cmp_ps_mask(x, _mm512_set1_ps(38.0f), _CMP_GT_OQ),
+                            _mm512_cmp_ps_mask(x, _mm512_set1_ps(-37.0f), _CMP_LT_OQ));
+        }
+
+        inline __m512
+        expm1_ps(__m512 x)
+        {
+          // 2^n * (e^r - 1) + (2^n - 1); n = 0 leaves the polynomial alone
+          __m512 n = exp_round(_mm512_mul_ps(x, _mm512_set1_ps(inv_ln2)));
+          __m512 r = exp_reduce(x, n);
+          const __m512 one = _mm512_set1_ps(1.0f);
+          __m512 scale = _mm512_scalef_ps(one, n);
+          __m512 result = _mm512_fmadd_ps(scale, expm1_poly_ps(r), _mm512_sub_ps(scale, one));
+          result = _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(x, _mm512_set1_ps(88.0f), _CMP_GT_OQ),
+                                      _mm512_set1_ps(1e38f));
+          return _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(x, _mm512_set1_ps(-87.0f), _CMP_LT_OQ),
+                                    _mm512_set1_ps(-1.0f));
+        }
+
+        /**
+         * atanh series of the scalar FastMath::log on a mantissa,
+         * log(m) = 2t(1 + t²/3 + ...), t = (m - 1) / (m + 1)
+         */
+        inline __m512
+        log_series_ps(__m512 mantissa)
+        {
+          const __m512 one = _mm512_set1_ps(1.0f);
+          __m512 t = _mm512_div_ps(_mm512_sub_ps(mantissa, one), _mm512_add_ps(mantissa, one));
+          __m512 t2 = _mm512_mul_ps(t, t);
+
+          __m512 poly = _mm512_set1_ps(2.0f / 9.0f);
+          poly = _mm512_fmadd_ps(poly, t2, _mm512_set1_ps(2.0f / 7.0f));
+          poly = _mm512_fmadd_ps(poly, t2, _mm512_set1_ps(2.0f / 5.0f));
+          poly = _mm512_fmadd_ps(poly, t2, _mm512_set1_ps(2.0f / 3.0f));
+          poly = _mm512_fmadd_ps(poly, t2, _mm512_set1_ps(2.0f));
+          return _mm512_mul_ps(poly, t);
+        }
+
+        /**
+         * Splits x into exponent and mantissa with vgetexpps / vgetmantps and
+         * evaluates the atanh series of the scalar FastMath::log on the mantissa.
+         * Returns log(mantissa); the exponent is written to `exponent`.
+         */
+        inline __m512
+        log_mantissa_ps(__m512 x, __m512 &exponent)
+        {
+          exponent = _mm512_getexp_ps(x);
+          return log_series_ps(_mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero));
+        }
+
+        /**
+         * As log_mantissa_ps, with the mantissa centred on 1 ([√½, √2)) like
+         * the scalar log2, log10 and log1p
+         */
+        inline __m512
+        log_mantissa_centred_ps(__m512 x, __m512 &exponent)
+        {
+          exponent = _mm512_getexp_ps(x);
+          __m512 mantissa = _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+          __mmask16 upper = _mm512_cmp_ps_mask(mantissa, _mm512_set1_ps(sqrt2), _CMP_GT_OQ);
+          mantissa = _mm512_mask_mul_ps(mantissa, upper, mantissa, _mm512_set1_ps(0.5f));
+          exponent = _mm512_mask_add_ps(exponent, upper, exponent, _mm512_set1_ps(1.0f));
+          return log_series_ps(mantissa);
+        }
+
+        /**
+         * Invalid input (x <= 0) maps to `invalid_value` (-1e38 for log), as
+         * in the scalar version
+         */
+        inline __m512
+        log_invalid(__m512 x, __m512 result, float invalid_value = -1e38f)
+        {
+          __mmask16 invalid = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LE_OQ);
+          return _mm512_mask_mov_ps(result, invalid, _mm512_set1_ps(invalid_value));
+        }
+
+        inline __m512
+        log_ps(__m512 x)
+        {
+          __m512 exponent;
+          __m512 poly = log_mantissa_ps(x, exponent);
+          return log_invalid(x, _mm512_fmadd_ps(exponent, _mm512_set1_ps(ln2), poly));
+        }
+
+        inline __m512
+        log2_ps(__m512 x)
+        {
+          // The exponent is already base 2, so only the mantissa term is scaled
+          __m512 exponent;
+          __m512 poly = log_mantissa_centred_ps(x, exponent);
+          return log_invalid(x, _mm512_fmadd_ps(poly, _mm512_set1_ps(inv_ln2), exponent), -1e38f * inv_ln2);
+        }
+
+        inline __m512
+        log10_ps(__m512 x)
+        {
+          __m512 exponent;
+          __m512 poly = log_mantissa_centred_ps(x, exponent);
+          __m512 result = _mm512_fmadd_ps(exponent, _mm512_set1_ps(log10_2), _mm512_mul_ps(poly, _mm512_set1_ps(inv_ln10)));
+          return log_invalid(x, result, -1e38f * inv_ln10);
+        }
+
+        inline __m512
+        log1p_ps(__m512 x)
+        {
+          // u = 1 + x, plus its rounding error (x - (u - 1)) / u
+          const __m512 one = _mm512_set1_ps(1.0f);
+          // (the FMA keeps -ffast-math from folding x - (u - 1) to 0)
+          __m512 u = _mm512_add_ps(x, one);
+          __m512 correction = _mm512_div_ps(_mm512_sub_ps(x, _mm512_fmsub_ps(u, one, one)), u);
+
+          __m512 exponent;
+          __m512 poly = _mm512_add_ps(log_mantissa_centred_ps(u, exponent), correction);
+          __m512 result = _mm512_fmadd_ps(exponent, _mm512_set1_ps(ln2_lo), poly);
+          result = _mm512_fmadd_ps(exponent, _mm512_set1_ps(ln2_hi), result);
+          __mmask16 invalid = _mm512_cmp_ps_mask(x, _mm512_set1_ps(-1.0f), _CMP_LE_OQ);
+          return _mm512_mask_mov_ps(result, invalid, _mm512_set1_ps(-1e38f));
+        }
+
+        /**
+         * base^exponent with the special cases of the scalar FastMath::pow.
+         * Integer exponents with |n| <= 32 use branch-free binary
+         * exponentiation; all other lanes use exp(exponent * log(base)).
+         */
+        inline __m512
+        pow_ps(__m512 base, __m512 exponent)
+        {
+          const __m512 zero = _mm512_setzero_ps();
+          const __m512 one = _mm512_set1_ps(1.0f);
+          __m512 abs_base = _mm512_abs_ps(base);
+
+          // General case: exp(exponent * log(|base|)); negative base is invalid
+          __m512 result = exp_ps(_mm512_mul_ps(exponent, log_ps(abs_base)));
+          result = _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(base, zero, _CMP_LT_OQ), zero);
+
+          // Integer exponents; the unsigned compare keeps the INT32_MIN of an
+          // out-of-range conversion from counting as small
+          __m512i int_exp = _mm512_cvttps_epi32(exponent);
+          __m512i abs_exp = _mm512_abs_epi32(int_exp);
+          __mmask16 is_int = _mm512_cmp_ps_mask(exponent, _mm512_cvtepi32_ps(int_exp), _CMP_EQ_OQ) &
+                             _mm512_cmple_epu32_mask(abs_exp, _mm512_set1_epi32(32));
+
+          __m512 int_result = one;
+          __m512 power = abs_base;
+          __m512i bits = abs_exp;
+          for (int i = 0; i < 6; ++i)
+          {
+            __mmask16 bit = _mm512_test_epi32_mask(bits, _mm512_set1_epi32(1));
+            int_result = _mm512_mask_mul_ps(int_result, bit, int_result, power);
+            power = _mm512_mul_ps(power, power);
+            bits = _mm512_srli_epi32(bits, 1);
+          }
+          __mmask16 negative_exp = _mm512_cmplt_epi32_mask(int_exp, _mm512_setzero_si512());
+          int_result = _mm512_mask_div_ps(int_result, negative_exp, one, int_result);
+          // Odd integer exponent keeps the sign of the base
+          __mmask16 odd = _mm512_test_epi32_mask(int_exp, _mm512_set1_epi32(1));
+          // (float bitwise ops need AVX512DQ, so work on the integer view)
+          __m512i base_sign = _mm512_and_epi32(_mm512_castps_si512(base), _mm512_set1_epi32(INT32_MIN));
+          __m512i signed_result = _mm512_castps_si512(int_result);
+          signed_result = _mm512_mask_xor_epi32(signed_result, odd, signed_result, base_sign);
+          int_result = _mm512_castsi512_ps(signed_result);
+          result = _mm512_mask_mov_ps(result, is_int, int_result);
+
+          // Special cases, lowest priority first
+          result = _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(base, one, _CMP_EQ_OQ), one);
+          __mmask16 zero_base = _mm512_cmp_ps_mask(base, zero, _CMP_EQ_OQ);
+          __mmask16 positive_exp = _mm512_cmp_ps_mask(exponent, zero, _CMP_GT_OQ);
+          result = _mm512_mask_mov_ps(result, zero_base & positive_exp, zero);
+          result = _mm512_mask_mov_ps(result, zero_base & ~positive_exp, _mm512_set1_ps(1e38f));
+          result = _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(exponent, one, _CMP_EQ_OQ), base);
+          return _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(exponent, zero, _CMP_EQ_OQ), one);
+        }
+
+        constexpr float min_normal = 1.17549435e-38f; // FLT_MIN
+        constexpr float max_float = 3.40282347e+38f;  // FLT_MAX
+
+        /**
+         * vrsqrt14ps estimate (14 bits) refined by the Newton-Raphson step
+         * of the scalar FastMath::rsqrt, y + y/2 * (1 - x*y*y)
+         */
+        inline __m512
+        rsqrt_estimate(__m512 x)
+        {
+          const __m512 y = _mm512_rsqrt14_ps(x);
+          const __m512 e = _mm512_fnmadd_ps(_mm512_mul_ps(x, y), y, _mm512_set1_ps(1.0f));
+          return _mm512_fmadd_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), y), e, y);
+        }
+
+        inline __m512
+        rsqrt_ps(__m512 x)
+        {
+          const __mmask16 tiny = _mm512_cmp_ps_mask(x, _mm512_set1_ps(min_normal), _CMP_LT_OQ);
+          return _mm512_mask_mov_ps(rsqrt_estimate(x), tiny, _mm512_set1_ps(1e38f));
+        }
+
+        /**
+         * sqrt(x) = x * rsqrt(x), refined with one Newton-Raphson step on
+         * the root itself; faster than vsqrtps (which is not pipelined on
+         * most cores) and within 1 ulp (14-bit estimate). Lanes below
+         * FLT_MIN give 0; +inf, where x * rsqrt(x) is inf * 0, passes through.
+         */
+        inline __m512
+        sqrt_ps(__m512 x)
+        {
+          const __m512 y = _mm512_rsqrt14_ps(x);
+          const __m512 s = _mm512_mul_ps(x, y);
+          const __m512 h = _mm512_mul_ps(_mm512_set1_ps(0.5f), y);
+          const __m512 r = _mm512_fnmadd_ps(s, h, _mm512_set1_ps(0.5f));
+          const __mmask16 valid = _mm512_cmp_ps_mask(x, _mm512_set1_ps(min_normal), _CMP_GE_OQ);
+          const __mmask16 infinite = _mm512_cmp_ps_mask(x, _mm512_set1_ps(max_float), _CMP_GT_OQ);
+          return _mm512_mask_mov_ps(_mm512_maskz_mov_ps(valid, _mm512_fmadd_ps(s, r, s)), infinite, x);
+        }
+
+        /**
+         * 1/|v| from the squared length, 0 below FLT_MIN
+         */
+        inline __m512
+        inverse_length(__m512 length_squared)
+        {
+          const __mmask16 valid = _mm512_cmp_ps_mask(length_squared, _mm512_set1_ps(min_normal), _CMP_GE_OQ);
+          return _mm512_maskz_mov_ps(valid, rsqrt_estimate(length_squared));
+        }
+
+        /**
+         * Calls kernel(i, mask) for every block of 16 elements, with a full
+         * constant mask (which the compiler turns into plain loads and
+         * stores) except on the last, partial block
+         */
+        template <typename Kernel>
+        inline void
+        for_each_block(std::size_t n, Kernel kernel)
+        {
+          std::size_t i = 0;
+          for (; i + 16 <= n; i += 16)
+          {
+            kernel(i, static_cast<__mmask16>(0xFFFF));
+          }
+          if (i < n)
+          {
+            kernel(i, static_cast<__mmask16>((1u << (n - i)) - 1u));
+          }
+        }
+
+        /**
+         * Applies a 16-lane kernel over a buffer. The remainder is handled
+         * with masked loads and stores, so no scalar tail loop is needed.
+         */
+        template <typename Kernel>
+        inline void
+        transform(const float *in, float *out, std::size_t n, Kernel kernel)
+        {
+          std::size_t i = 0;
+          for (; i + 16 <= n; i += 16)
+          {
+            _mm512_storeu_ps(out + i, kernel(_mm512_loadu_ps(in + i)));
+          }
+          if (i < n)
+          {
+            __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1u);
+            __m512 x = _mm512_maskz_loadu_ps(mask, in + i);
+            _mm512_mask_storeu_ps(out + i, mask, kernel(x));
+          }
+        }
+
+        template <typename Kernel>
+        inline void
+        transform(const float *a, const float *b, float *out, std::size_t n, Kernel kernel)
+        {
+          std::size_t i = 0;
+          for (; i + 16 <= n; i += 16)
+          {
+            _mm512_storeu_ps(out + i, kernel(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+          }
+          if (i < n)
+          {
+            __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1u);
+            __m512 x = _mm512_maskz_loadu_ps(mask, a + i);
+            __m512 y = _mm512_maskz_loadu_ps(mask, b + i);
+            _mm512_mask_storeu_ps(out + i, mask, kernel(x, y));
+          }
+        }
+      } // namespace
+
+      void
+      exp(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, exp_ps);
+      }
+
+      void
+      exp2(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, exp2_ps);
+      }
+
+      void
+      exp10(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, exp10_ps);
+      }
+
+      void
+      expm1(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, expm1_ps);
+      }
+
+      void
+      log(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log_ps);
+      }
+
+      void
+      log2(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log2_ps);
+      }
+
+      void
+      log10(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log10_ps);
+      }
+
+      void
+      log1p(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, log1p_ps);
+      }
+
+      void
+      pow(const float *base, const float *exponent, float *out, std::size_t n)
+      {
+        transform(base, exponent, out, n, pow_ps);
+      }
+
+      void
+      sqrt(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, sqrt_ps);
+      }
+
+      void
+      rsqrt(const float *in, float *out, std::size_t n)
+      {
+        transform(in, out, n, rsqrt_ps);
+      }
+
+      void
+      normalize2(const float *x, const float *y, float *out_x, float *out_y, std::size_t n)
+      {
+        const auto kernel = [&](std::size_t i, __mmask16 mask) {
+          const __m512 vx = _mm512_maskz_loadu_ps(mask, x + i);
+          const __m512 vy = _mm512_maskz_loadu_ps(mask, y + i);
+          const __m512 scale = inverse_length(_mm512_fmadd_ps(vx, vx, _mm512_mul_ps(vy, vy)));
+          _mm512_mask_storeu_ps(out_x + i, mask, _mm512_mul_ps(vx, scale));
+          _mm512_mask_storeu_ps(out_y + i, mask, _mm512_mul_ps(vy, scale));
+        };
+        for_each_block(n, kernel);
+      }
+
+      void
+      normalize3(const float *x, const float *y, const float *z, float *out_x, float *out_y, float *out_z,
+                 std::size_t n)
+      {
+        const auto kernel = [&](std::size_t i, __mmask16 mask) {
+          const __m512 vx = _mm512_maskz_loadu_ps(mask, x + i);
+          const __m512 vy = _mm512_maskz_loadu_ps(mask, y + i);
+          const __m512 vz = _mm512_maskz_loadu_ps(mask, z + i);
+          const __m512 length_squared = _mm512_fmadd_ps(vx, vx, _mm512_fmadd_ps(vy, vy, _mm512_mul_ps(vz, vz)));
+          const __m512 scale = inverse_length(length_squared);
+          _mm512_mask_storeu_ps(out_x + i, mask, _mm512_mul_ps(vx, scale));
+          _mm512_mask_storeu_ps(out_y + i, mask, _mm512_mul_ps(vy, scale));
+          _mm512_mask_storeu_ps(out_z + i, mask, _mm512_mul_ps(vz, scale));
+        };
+        for_each_block(n, kernel);
+      }
+    } // namespace avx512
+  } // namespace detail
+} // namespace FastMath
+
+#endif // FAST_MATH_ENABLE_AVX512
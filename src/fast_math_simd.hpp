@@ -0,0 +1,139 @@
+/**
+ * @file fast_math_simd.hpp
+ * @brief Internal declarations of the batch kernels and the ISA dispatch table
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Kernels follow the batch API contract from fast_math.hpp:
+ * out[i] = f(in[i]) for i in [0, n), in-place allowed.
+ * Each ISA tier lives in its own translation unit compiled with the matching
+ * -m flags (see CMakeLists.txt); the library itself is built for the
+ * baseline target, and kernels() binds every entry point to the best tier
+ * the running CPU supports.
+ * This header is private to the library and is not installed.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "fast_math.hpp"
+
+namespace FastMath
+{
+  namespace detail
+  {
+    using UnaryKernel = void (*)(const float *, float *, std::size_t);
+    using BinaryKernel = void (*)(const float *, const float *, float *, std::size_t);
+    /// fmod by one divisor with its inverse, see fmod_reciprocal() in fast_math_impl.hpp
+    using DivisorKernel = void (*)(const float *, float *, std::size_t, float, float);
+    using SinCosKernel = void (*)(const float *, float *, float *, std::size_t);
+    using Normalize2Kernel = void (*)(const float *, const float *, float *, float *, std::size_t);
+    using Normalize3Kernel = void (*)(const float *, const float *, const float *, float *, float *, float *,
+                                      std::size_t);
+
+    /**
+     * Batch entry points bound to one ISA tier per function
+     */
+    struct KernelTable
+    {
+      Isa isa;
+      UnaryKernel sin;
+      UnaryKernel cos;
+      SinCosKernel sincos;
+      UnaryKernel sqrt;
+      UnaryKernel rsqrt;
+      Normalize2Kernel normalize2;
+      Normalize3Kernel normalize3;
+      UnaryKernel tan;
+      UnaryKernel asin;
+      UnaryKernel acos;
+      UnaryKernel atan;
+      BinaryKernel atan2;
+      UnaryKernel exp;
+      UnaryKernel exp2;
+      UnaryKernel exp10;
+      UnaryKernel expm1;
+      UnaryKernel log;
+      UnaryKernel log10;
+      UnaryKernel log2;
+      UnaryKernel log1p;
+      BinaryKernel pow;
+      BinaryKernel fmod;
+      DivisorKernel fmod_reciprocal;
+      UnaryKernel wrap_angle;
+      UnaryKernel ceil;
+      UnaryKernel floor;
+      UnaryKernel round;
+      UnaryKernel sinh;
+      UnaryKernel cosh;
+      UnaryKernel tanh;
+      UnaryKernel asinh;
+      UnaryKernel acosh;
+      UnaryKernel atanh;
+    };
+
+    /**
+     * Dispatch table for the running CPU, initialized on first use
+     */
+    const KernelTable &kernels();
+
+#ifdef FAST_MATH_PAYNE_HANEK
+    /**
+     * Out-of-line reduce_two_pi_large() from fast_math_impl.hpp, for the ISA
+     * kernels, which do not include the scalar definitions
+     */
+    float payne_hanek(float theta);
+#endif
+
+#ifdef FAST_MATH_ENABLE_AVX2
+    namespace avx2
+    {
+      void sin(const float *in, float *out, std::size_t n);
+      void cos(const float *in, float *out, std::size_t n);
+      void sincos(const float *in, float *sin_out, float *cos_out, std::size_t n);
+      void asin(const float *in, float *out, std::size_t n);
+      void acos(const float *in, float *out, std::size_t n);
+      void atan(const float *in, float *out, std::size_t n);
+      void atan2(const float *y, const float *x, float *out, std::size_t n);
+      void fmod_reciprocal(const float *in, float *out, std::size_t n, float divisor, float inverse);
+      void wrap_angle(const float *in, float *out, std::size_t n);
+      void exp(const float *in, float *out, std::size_t n);
+      void exp2(const float *in, float *out, std::size_t n);
+      void exp10(const float *in, float *out, std::size_t n);
+      void expm1(const float *in, float *out, std::size_t n);
+      void log(const float *in, float *out, std::size_t n);
+      void log2(const float *in, float *out, std::size_t n);
+      void log10(const float *in, float *out, std::size_t n);
+      void log1p(const float *in, float *out, std::size_t n);
+      void pow(const float *base, const float *exponent, float *out, std::size_t n);
+      void sqrt(const float *in, float *out, std::size_t n);
+      void rsqrt(const float *in, float *out, std::size_t n);
+      void normalize2(const float *x, const float *y, float *out_x, float *out_y, std::size_t n);
+      void normalize3(const float *x, const float *y, const float *z, float *out_x, float *out_y, float *out_z,
+                      std::size_t n);
+    } // namespace avx2
+#endif
+
+#ifdef FAST_MATH_ENABLE_AVX512
+    namespace avx512
+    {
+      void exp(const float *in, float *out, std::size_t n);
+      void exp2(const float *in, float *out, std::size_t n);
+      void exp10(const float *in, float *out, std::size_t n);
+      void expm1(const float *in, float *out, std::size_t n);
+      void log(const float *in, float *out, std::size_t n);
+      void log2(const float *in, float *out, std::size_t n);
+      void log10(const float *in, float *out, std::size_t n);
+      void log1p(const float *in, float *out, std::size_t n);
+      void pow(const float *base, const float *exponent, float *out, std::size_t n);
+      void sqrt(const float *in, float *out, std::size_t n);
+      void rsqrt(const float *in, float *out, std::size_t n);
+      void normalize2(const float *x, const float *y, float *out_x, float *out_y, std::size_t n);
+      void normalize3(const float *x, const float *y, const float *z, float *out_x, float *out_y, float *out_z,
+                      std::size_t n);
+    } // namespace avx512
+#endif
+  } // namespace detail
+} // namespace FastMath
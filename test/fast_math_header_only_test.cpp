@@ -0,0 +1,127 @@
+/**
+ * @file fast_math_header_only_test.cpp
+ * @brief Tests for the header-only build (FAST_MATH_HEADER_ONLY)
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Linked against fast_math_cpp_header_only only, so every symbol used here
+ * must come from the inline definitions in the headers.
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include "fast_math.hpp"
+
+#ifndef FAST_MATH_HEADER_ONLY
+#error "fast_math_header_only_test must be built with FAST_MATH_HEADER_ONLY"
+#endif
+
+// Scalar functions are usable without the compiled library
+TEST(FastMathHeaderOnlyTest, ScalarPrecisionTest)
+{
+    const int num_samples = 10000;
+
+    double max_sin_error = 0.0;
+    double max_exp_rel_error = 0.0;
+    double max_log_rel_error = 0.0;
+    double max_tanh_error = 0.0;
+
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float angle = -2.0f * M_PI + (4.0f * M_PI * i / num_samples);
+        max_sin_error = std::max(max_sin_error, static_cast<double>(std::abs(FastMath::sin(angle) - std::sin(angle))));
+
+        float value = -10.0f + (20.0f * i / num_samples);
+        max_exp_rel_error = std::max(max_exp_rel_error,
+                                     static_cast<double>(std::abs(FastMath::exp(value) - std::exp(value)) / std::exp(value)));
+        float tanh_value = 0.5f * value; // [-5, 5], as in FastMathTest.TanhPrecisionTest
+        max_tanh_error = std::max(max_tanh_error,
+                                  static_cast<double>(std::abs(FastMath::tanh(tanh_value) - std::tanh(tanh_value))));
+
+        float positive = 0.01f + (100.0f * i / num_samples);
+        max_log_rel_error = std::max(max_log_rel_error,
+                                     static_cast<double>(std::abs(FastMath::log(positive) - std::log(positive)) /
+                                                         std::max(1e-3f, std::abs(std::log(positive)))));
+    }
+
+    std::cout << std::fixed << std::setprecision(8);
+    std::cout << "Header-only sin max absolute error: " << max_sin_error << std::endl;
+    std::cout << "Header-only exp max relative error: " << max_exp_rel_error << std::endl;
+    std::cout << "Header-only log max relative error: " << max_log_rel_error << std::endl;
+    std::cout << "Header-only tanh max absolute error: " << max_tanh_error << std::endl;
+
+    EXPECT_LT(max_sin_error, 0.01);
+    EXPECT_LT(max_exp_rel_error, 0.01);
+    EXPECT_LT(max_log_rel_error, 0.02);
+    EXPECT_LT(max_tanh_error, 5e-5);
+}
+
+// The precision-tier templates are defined inline as well
+TEST(FastMathHeaderOnlyTest, PrecisionTierTest)
+{
+    using FastMath::Precision;
+
+    EXPECT_NEAR(FastMath::exp<Precision::High>(1.0f), std::exp(1.0f), 1e-6f);
+    EXPECT_NEAR(FastMath::log<Precision::High>(2.0f), std::log(2.0f), 1e-7f);
+    EXPECT_NEAR(FastMath::sin<Precision::High>(1.0f), std::sin(1.0f), 1e-7f);
+    EXPECT_NEAR(FastMath::cos<Precision::High>(1.0f), std::cos(1.0f), 1e-7f);
+    EXPECT_NEAR(FastMath::exp<Precision::Low>(1.0f), std::exp(1.0f), 0.02f);
+    EXPECT_EQ(FastMath::exp<Precision::Medium>(1.0f), FastMath::exp(1.0f));
+}
+
+// Batch API falls back to inline loops without runtime dispatch
+TEST(FastMathHeaderOnlyTest, BatchConsistencyTest)
+{
+    EXPECT_EQ(FastMath::active_isa(), FastMath::Isa::Generic);
+
+    const int num_samples = 1003;
+    std::vector<float> input(num_samples);
+    std::vector<float> second(num_samples);
+    std::vector<float> output(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        input[i] = 0.1f + (10.0f * i / num_samples);
+        second[i] = -3.0f + (6.0f * ((i * 7) % num_samples) / num_samples);
+    }
+
+    // sin vectorizes here, and FMA contraction may differ from the scalar call in the last bit
+    FastMath::sin(input.data(), output.data(), output.size());
+    for (int i = 0; i < num_samples; ++i)
+    {
+        EXPECT_FLOAT_EQ(output[i], FastMath::sin(input[i]));
+    }
+
+    FastMath::pow(input.data(), second.data(), output.data(), output.size());
+    for (int i = 0; i < num_samples; ++i)
+    {
+        EXPECT_EQ(output[i], FastMath::pow(input[i], second[i]));
+    }
+}
+
+// A plain user loop over scalar calls: with inline definitions the compiler
+// can inline (and vectorize) this instead of making one call per element
+TEST(FastMathHeaderOnlyTest, UserLoopTest)
+{
+    const int num_samples = 4096;
+    std::vector<float> input(num_samples);
+    std::vector<float> output(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        input[i] = -100.0f + (200.0f * i / num_samples);
+    }
+
+    for (int i = 0; i < num_samples; ++i)
+    {
+        output[i] = FastMath::floor(input[i]);
+    }
+
+    for (int i = 0; i < num_samples; ++i)
+    {
+        EXPECT_EQ(output[i], std::floor(input[i]));
+    }
+}
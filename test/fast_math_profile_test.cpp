@@ -0,0 +1,141 @@
+/**
+ * @file fast_math_profile_test.cpp
+ * @brief Tests for the FAST_MATH_PROFILE call and path counters
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Linked against fast_math_cpp_header_only with FAST_MATH_PROFILE defined,
+ * so the counters are compiled into the inline definitions used here.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "fast_math.hpp"
+#include "fast_math_profile.hpp"
+
+#ifndef FAST_MATH_PROFILE
+#error "fast_math_profile_test must be built with FAST_MATH_PROFILE"
+#endif
+
+using FastMath::profile::Function;
+using FastMath::profile::Path;
+
+// Every pow shortcut is counted once per call that takes it
+TEST(FastMathProfileTest, PowPathCounts)
+{
+    FastMath::profile::reset();
+
+    volatile float sink = 0.0f;
+    for (int i = 0; i < 10; ++i)
+    {
+        sink = sink + FastMath::pow(1.5f, 2.0f);
+    }
+    for (int i = 0; i < 5; ++i)
+    {
+        sink = sink + FastMath::pow(1.5f, 0.3f);
+    }
+    sink = sink + FastMath::pow(-2.0f, 0.3f);
+    sink = sink + FastMath::pow(2.0f, 7.0f);
+
+    EXPECT_EQ(FastMath::profile::calls(Function::Pow), 17u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::PowSquare), 10u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::PowGeneral), 5u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::PowNegativeBase), 1u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::PowInteger), 1u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::PowCube), 0u);
+
+    // Bases 1.5 and -2 / 2 fall in the [1, 2) and [2, 4) bins
+    EXPECT_EQ(FastMath::profile::magnitude_count(Function::Pow, FastMath::profile::magnitude_bin(1.0f)), 15u);
+    EXPECT_EQ(FastMath::profile::magnitude_count(Function::Pow, FastMath::profile::magnitude_bin(2.0f)), 2u);
+}
+
+// exp and log called from inside pow are attributed to pow only
+TEST(FastMathProfileTest, NestedCallsNotCounted)
+{
+    FastMath::profile::reset();
+
+    volatile float sink = FastMath::pow(3.0f, 0.7f);
+    sink = sink + FastMath::sinh(2.0f) + FastMath::tan(0.5f);
+
+    EXPECT_EQ(FastMath::profile::calls(Function::Pow), 1u);
+    EXPECT_EQ(FastMath::profile::calls(Function::Sinh), 1u);
+    EXPECT_EQ(FastMath::profile::calls(Function::Tan), 1u);
+    EXPECT_EQ(FastMath::profile::calls(Function::Exp), 0u);
+    EXPECT_EQ(FastMath::profile::calls(Function::Log), 0u);
+    EXPECT_EQ(FastMath::profile::calls(Function::Sincos), 0u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::SinhExp), 1u);
+
+    // A direct call after the nested ones is counted again
+    sink = sink + FastMath::exp(1.0f);
+    EXPECT_EQ(FastMath::profile::calls(Function::Exp), 1u);
+}
+
+// Branchless functions record the path selected for each input
+TEST(FastMathProfileTest, SelectPaths)
+{
+    FastMath::profile::reset();
+
+    volatile float sink = 0.0f;
+    for (float x : {0.1f, -0.3f, 1.0f, 2.0f, 3.0f, 6.0f, -7.0f})
+    {
+        sink = sink + FastMath::tanh(x);
+    }
+    sink = sink + FastMath::fmod(100.0f, 3.0f) + FastMath::fmod(7.0f, 2.0f) + FastMath::fmod(1.0f, 0.0f);
+
+    EXPECT_EQ(FastMath::profile::calls(Function::Tanh), 7u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::TanhTaylor), 2u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::TanhExp), 3u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::TanhSaturated), 2u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::FmodLargeOperand), 1u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::FmodFast), 1u);
+    EXPECT_EQ(FastMath::profile::path_count(Path::FmodZeroDivisor), 1u);
+}
+
+// Counts from every thread are summed, including threads that have exited
+TEST(FastMathProfileTest, ThreadsAggregate)
+{
+    FastMath::profile::reset();
+
+    const int num_threads = 4;
+    const int calls_per_thread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([] {
+            volatile float sink = 0.0f;
+            for (int i = 0; i < calls_per_thread; ++i)
+            {
+                sink = sink + FastMath::exp(0.001f * i);
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(FastMath::profile::calls(Function::Exp), static_cast<std::uint64_t>(num_threads * calls_per_thread));
+
+    FastMath::profile::reset();
+    EXPECT_EQ(FastMath::profile::calls(Function::Exp), 0u);
+}
+
+TEST(FastMathProfileTest, Dump)
+{
+    FastMath::profile::reset();
+
+    volatile float sink = FastMath::pow(2.0f, 2.0f);
+    (void)sink;
+
+    std::ostringstream out;
+    FastMath::profile::dump(out);
+    const std::string text = out.str();
+    std::cout << text;
+
+    EXPECT_NE(text.find("pow: 1 calls"), std::string::npos);
+    EXPECT_NE(text.find("exponent == 2"), std::string::npos);
+    EXPECT_EQ(text.find("sin:"), std::string::npos);
+}
@@ -0,0 +1,104 @@
+/**
+ * @file fast_math_span_test.cpp
+ * @brief Tests for the C++20 std::span batch overloads
+ * @author MCL Development Team
+ * @version 2.0
+ * @date 2025
+ *
+ * Built as C++20 against the compiled library (the rest of the project is
+ * C++17, where the overloads are not declared).
+ */
+
+#include <gtest/gtest.h>
+#include <span>
+#include <vector>
+#include "fast_math.hpp"
+
+#ifndef FAST_MATH_HAS_SPAN
+#error "fast_math_span_test must be built as C++20 with <span>"
+#endif
+
+namespace
+{
+    std::vector<float> ramp(std::size_t n, float start, float step)
+    {
+        std::vector<float> values(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            values[i] = start + step * static_cast<float>(i);
+        }
+        return values;
+    }
+} // namespace
+
+// Span overloads forward to the pointer batch API
+TEST(FastMathSpanTest, MatchesPointerOverloads)
+{
+    const std::vector<float> in = ramp(37, -3.0f, 0.17f);
+    std::vector<float> expected(in.size());
+    std::vector<float> out(in.size());
+
+    FastMath::exp(in.data(), expected.data(), in.size());
+    FastMath::exp(std::span<const float>(in), std::span<float>(out));
+    EXPECT_EQ(out, expected) << "exp";
+
+    FastMath::wrap_angle(in.data(), expected.data(), in.size());
+    FastMath::wrap_angle(std::span<const float>(in), std::span<float>(out));
+    EXPECT_EQ(out, expected) << "wrap_angle";
+
+    const std::vector<float> bases = ramp(in.size(), 0.5f, 0.1f);
+    FastMath::pow(bases.data(), in.data(), expected.data(), in.size());
+    FastMath::pow(std::span<const float>(bases), std::span<const float>(in), std::span<float>(out));
+    EXPECT_EQ(out, expected) << "pow";
+
+    std::vector<float> expected_cos(in.size());
+    std::vector<float> out_cos(in.size());
+    FastMath::sincos(in.data(), expected.data(), expected_cos.data(), in.size());
+    FastMath::sincos(std::span<const float>(in), std::span<float>(out), std::span<float>(out_cos));
+    EXPECT_EQ(out, expected) << "sincos (sin)";
+    EXPECT_EQ(out_cos, expected_cos) << "sincos (cos)";
+
+    // In place through the same buffer
+    std::vector<float> in_place(in);
+    FastMath::sin(std::span<const float>(in_place), std::span<float>(in_place));
+    FastMath::sin(in.data(), expected.data(), in.size());
+    EXPECT_EQ(in_place, expected) << "in-place sin";
+}
+
+// The element count is the smallest extent; the rest of the output is untouched
+TEST(FastMathSpanTest, ShorterExtentBoundsCount)
+{
+    const std::vector<float> in = ramp(20, 0.1f, 0.25f);
+    std::vector<float> out(in.size(), -1.0f);
+
+    FastMath::log(std::span<const float>(in).first(11), std::span<float>(out));
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        if (i < 11)
+        {
+            EXPECT_NEAR(out[i], FastMath::log(in[i]), 1e-5f) << "log, index " << i;
+        }
+        else
+        {
+            EXPECT_EQ(out[i], -1.0f) << "log, index " << i;
+        }
+    }
+
+    out.assign(in.size(), -1.0f);
+    FastMath::sqrt(std::span<const float>(in), std::span<float>(out).first(5));
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        EXPECT_EQ(out[i] == -1.0f, i >= 5) << "sqrt, index " << i;
+    }
+
+    out.assign(in.size(), -1.0f);
+    FastMath::atan2(std::span<const float>(in), std::span<const float>(in).first(7), std::span<float>(out));
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        EXPECT_EQ(out[i] == -1.0f, i >= 7) << "atan2, index " << i;
+    }
+
+    // Empty spans are no-ops
+    FastMath::cos(std::span<const float>(), std::span<float>(out));
+    EXPECT_EQ(out[10], -1.0f);
+}
@@ -12,7 +12,23 @@
 #include <vector>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <tuple>
+#include <string>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <limits>
+#include <cstdint>
+#include <cstring>
 #include "fast_math.hpp"
+#include "fast_math_execution.hpp"
+#include "fast_math_expr.hpp"
+#include "fast_math_parallel.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
 
 class FastMathTest : public ::testing::Test
 {
@@ -172,6 +188,32 @@ TEST_F(FastMathTest, SqrtPrecisionTest)
     EXPECT_LT(avg_abs_error, 0.025) << "Average absolute error exceeds threshold";
 }
 
+// Precision test for rsqrt over the whole normal range
+TEST_F(FastMathTest, RsqrtPrecisionTest)
+{
+    std::cout << "\n=== Rsqrt Function Precision Test ===" << std::endl;
+
+    double max_rel_error = 0.0;
+    int samples = 0;
+    for (float value = 1.17549435e-38f; value < 3e38f; value *= 1.0137f)
+    {
+        const double expected = 1.0 / std::sqrt(static_cast<double>(value));
+        max_rel_error = std::max(max_rel_error, std::abs(FastMath::rsqrt(value) - expected) / expected);
+        ++samples;
+    }
+
+    std::cout << std::scientific << std::setprecision(2);
+    std::cout << "Samples: " << samples << ", max relative error: " << max_rel_error << std::endl;
+    EXPECT_LT(max_rel_error, 5e-7);
+
+    // Non-positive and subnormal inputs saturate, as pow(0, -x) does
+    EXPECT_EQ(FastMath::rsqrt(0.0f), 1e38f);
+    EXPECT_EQ(FastMath::rsqrt(-4.0f), 1e38f);
+    EXPECT_EQ(FastMath::rsqrt(1e-40f), 1e38f);
+    EXPECT_EQ(FastMath::sqrt(-4.0f), 0.0f);
+    EXPECT_EQ(FastMath::sqrt(2.0f), std::sqrt(2.0f));
+}
+
 // Precision test for tan function
 TEST_F(FastMathTest, TanPrecisionTest)
 {
@@ -255,8 +297,120 @@ TEST_F(FastMathTest, AsinPrecisionTest)
     std::cout << "Avg absolute error: " << avg_abs_error << std::endl;
     std::cout << "Avg relative error: " << avg_rel_error << std::endl;
 
-    EXPECT_LT(max_abs_error, 0.1) << "Max absolute error exceeds threshold";
-    EXPECT_LT(avg_abs_error, 0.01) << "Average absolute error exceeds threshold";
+    EXPECT_LT(max_abs_error, 1e-6) << "Max absolute error exceeds threshold";
+    EXPECT_LT(avg_abs_error, 1e-7) << "Average absolute error exceeds threshold";
+}
+
+// Precision test for acos function
+TEST_F(FastMathTest, AcosPrecisionTest)
+{
+    const int num_samples = 10000;
+    const float test_range = 1.0f; // Test range [-1, 1)
+
+    double max_abs_error = 0.0;
+    double max_rel_error = 0.0;
+    double sum_abs_error = 0.0;
+    double sum_rel_error = 0.0;
+
+    std::cout << "\n=== Acos Function Precision Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples in range [-1, 1)" << std::endl;
+
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float value = -test_range + (2.0f * test_range * i / num_samples);
+
+        float fast_result = FastMath::acos(value);
+        float std_result = std::acos(value);
+
+        double abs_error = std::abs(fast_result - std_result);
+        double rel_error = std::abs(abs_error / std_result);
+
+        max_abs_error = std::max(max_abs_error, abs_error);
+        max_rel_error = std::max(max_rel_error, rel_error);
+        sum_abs_error += abs_error;
+        sum_rel_error += rel_error;
+    }
+
+    double avg_abs_error = sum_abs_error / num_samples;
+    double avg_rel_error = sum_rel_error / num_samples;
+
+    std::cout << std::fixed << std::setprecision(8);
+    std::cout << "Max absolute error: " << max_abs_error << std::endl;
+    std::cout << "Max relative error: " << max_rel_error << std::endl;
+    std::cout << "Avg absolute error: " << avg_abs_error << std::endl;
+    std::cout << "Avg relative error: " << avg_rel_error << std::endl;
+
+    EXPECT_LT(max_abs_error, 1e-6) << "Max absolute error exceeds threshold";
+    EXPECT_LT(avg_abs_error, 1e-7) << "Average absolute error exceeds threshold";
+}
+
+// Precision test for atan function, including the |x| > 1 reciprocal fold and the batch kernel
+TEST_F(FastMathTest, AtanPrecisionTest)
+{
+    const int num_samples = 100003;
+    const float test_range = 100.0f; // Test range [-100, 100)
+
+    std::vector<float> values(num_samples);
+    std::vector<float> batch(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        values[i] = -test_range + (2.0f * test_range * i / num_samples);
+    }
+    FastMath::atan(values.data(), batch.data(), values.size());
+
+    double max_abs_error = 0.0;
+    double max_batch_error = 0.0;
+
+    std::cout << "\n=== Atan Function Precision Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples in range [-100, 100)" << std::endl;
+
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float fast_result = FastMath::atan(values[i]);
+        double std_result = std::atan(static_cast<double>(values[i]));
+
+        max_abs_error = std::max(max_abs_error, std::abs(fast_result - std_result));
+        max_batch_error = std::max(max_batch_error, std::abs(batch[i] - std_result));
+    }
+
+    std::cout << std::fixed << std::setprecision(8);
+    std::cout << "Max absolute error: " << max_abs_error << std::endl;
+    std::cout << "Batch max absolute error: " << max_batch_error << std::endl;
+
+    EXPECT_LT(max_abs_error, 4.5e-6) << "Max absolute error exceeds threshold";
+    EXPECT_LT(max_batch_error, 4.5e-6) << "Batch max absolute error exceeds threshold";
+
+    // Odd symmetry, fold point and limits
+    EXPECT_EQ(FastMath::atan(0.0f), 0.0f);
+    EXPECT_EQ(FastMath::atan(-2.5f), -FastMath::atan(2.5f));
+    EXPECT_NEAR(FastMath::atan(1.0f), M_PI / 4.0, 4e-6);
+    EXPECT_NEAR(FastMath::atan(1e30f), M_PI / 2.0, 4e-6);
+    EXPECT_NEAR(FastMath::atan(-1e30f), -M_PI / 2.0, 4e-6);
+
+    // atan2 quadrants and axes, scalar and batch
+    const std::vector<std::pair<float, float>> points = {
+        {1.0f, 1.0f}, {1.0f, -1.0f}, {-1.0f, -1.0f}, {-1.0f, 1.0f}, {3.0f, 0.0f},
+        {-3.0f, 0.0f}, {0.0f, -2.0f}, {0.0f, 0.0f}, {2.0f, 1e-3f}, {-1e-3f, -2.0f},
+    };
+    std::vector<float> y;
+    std::vector<float> x;
+    for (const auto &point : points)
+    {
+        y.push_back(point.first);
+        x.push_back(point.second);
+    }
+    std::vector<float> angles(points.size());
+    FastMath::atan2(y.data(), x.data(), angles.data(), points.size());
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        double expected = std::atan2(static_cast<double>(y[i]), static_cast<double>(x[i]));
+        EXPECT_NEAR(FastMath::atan2(y[i], x[i]), expected, 4.5e-6) << "atan2(" << y[i] << ", " << x[i] << ")";
+        EXPECT_NEAR(FastMath::atan2<FastMath::Precision::High>(y[i], x[i]), expected, 3e-7);
+        EXPECT_NEAR(angles[i], expected, 4.5e-6) << "batch atan2(" << y[i] << ", " << x[i] << ")";
+    }
+
+    // High keeps the direction of tiny vectors that Low/Medium snap to the y axis
+    EXPECT_NEAR(FastMath::atan2<FastMath::Precision::High>(1e-9f, 1e-9f), M_PI / 4.0, 3e-7);
 }
 
 // Precision test for exp function
@@ -347,6 +501,104 @@ TEST_F(FastMathTest, LogPrecisionTest)
     EXPECT_LT(avg_rel_error, 0.001) << "Average relative error exceeds threshold";
 }
 
+// Precision test for the exp2/exp10/expm1/log1p/log2/log10 family, scalar and batch
+TEST_F(FastMathTest, ExpLogFamilyPrecisionTest)
+{
+    const int num_samples = 100003;
+
+    std::cout << "\n=== Exp/Log Family Precision Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples per function" << std::endl;
+
+    using Scalar = float (*)(float);
+    using Batch = void (*)(const float *, float *, std::size_t);
+    struct Case
+    {
+        const char *name;
+        Scalar scalar;
+        Batch batch;
+        double (*reference)(double);
+        double min_value;
+        double max_value;
+        bool logarithmic;  // samples spread evenly over magnitudes
+        bool both_signs;   // alternate the sign of the samples
+        double error_floor; // errors are relative to max(|expected|, error_floor)
+        double tolerance;
+    };
+
+    const std::vector<Case> cases = {
+        {"exp2", FastMath::exp2, FastMath::exp2, std::exp2, -120.0, 120.0, false, false, 0.0, 4e-6},
+        {"exp10", FastMath::exp10, FastMath::exp10, [](double x) { return std::pow(10.0, x); }, -36.0, 36.0, false,
+         false, 0.0, 8e-6},
+        {"expm1", FastMath::expm1, FastMath::expm1, std::expm1, -80.0, 80.0, false, false, 0.0, 1.2e-5},
+        {"expm1 near 0", FastMath::expm1, FastMath::expm1, std::expm1, 1e-12, 0.3, true, true, 0.0, 1.2e-5},
+        {"log2", FastMath::log2, FastMath::log2, std::log2, 1e-30, 1e30, true, false, 1.0, 2e-7},
+        {"log10", FastMath::log10, FastMath::log10, std::log10, 1e-30, 1e30, true, false, 1.0, 2e-7},
+        {"log1p", FastMath::log1p, FastMath::log1p, std::log1p, -0.999, 1e6, false, false, 0.0, 3e-7},
+        {"log1p near 0", FastMath::log1p, FastMath::log1p, std::log1p, 1e-12, 0.9, true, true, 0.0, 3e-7},
+    };
+
+    std::vector<float> input(num_samples);
+    std::vector<float> output(num_samples);
+    for (const auto &c : cases)
+    {
+        for (int i = 0; i < num_samples; ++i)
+        {
+            double t = static_cast<double>(i) / num_samples;
+            if (c.logarithmic)
+            {
+                double magnitude = c.min_value * std::pow(c.max_value / c.min_value, t);
+                input[i] = static_cast<float>((c.both_signs && i % 2 == 1) ? -magnitude : magnitude);
+            }
+            else
+            {
+                input[i] = static_cast<float>(c.min_value + (c.max_value - c.min_value) * t);
+            }
+        }
+        c.batch(input.data(), output.data(), input.size());
+
+        double max_scalar_error = 0.0;
+        double max_batch_error = 0.0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            double expected = c.reference(input[i]);
+            double scale = std::max(std::abs(expected), c.error_floor);
+            max_scalar_error = std::max(max_scalar_error, std::abs(c.scalar(input[i]) - expected) / scale);
+            max_batch_error = std::max(max_batch_error, std::abs(output[i] - expected) / scale);
+        }
+
+        std::cout << std::scientific << std::setprecision(2);
+        std::cout << "  " << c.name << " max relative error: " << max_scalar_error << " (batch " << max_batch_error
+                  << ")" << std::endl;
+        EXPECT_LT(max_scalar_error, c.tolerance) << c.name;
+        EXPECT_LT(max_batch_error, c.tolerance) << c.name << " batch";
+    }
+
+    // Exact results on powers of two and integer exponents
+    for (int n = -126; n <= 127; ++n)
+    {
+        EXPECT_EQ(FastMath::exp2(static_cast<float>(n)), std::ldexp(1.0f, n)) << "exp2(" << n << ")";
+        EXPECT_EQ(FastMath::log2(std::ldexp(1.0f, n)), static_cast<float>(n)) << "log2(2^" << n << ")";
+    }
+    EXPECT_EQ(FastMath::log10(1.0f), 0.0f);
+    EXPECT_EQ(FastMath::log1p(0.0f), 0.0f);
+    EXPECT_EQ(FastMath::expm1(0.0f), 0.0f);
+
+    // Tiny arguments keep their value instead of rounding through 1 +- x
+    EXPECT_FLOAT_EQ(FastMath::expm1(1e-10f), 1e-10f);
+    EXPECT_FLOAT_EQ(FastMath::log1p(1e-10f), 1e-10f);
+    EXPECT_FLOAT_EQ(FastMath::log1p(-3e-9f), -3e-9f);
+
+    // Saturation and invalid input
+    EXPECT_EQ(FastMath::exp2(200.0f), 1e38f);
+    EXPECT_EQ(FastMath::exp2(-200.0f), 0.0f);
+    EXPECT_EQ(FastMath::exp10(40.0f), 1e38f);
+    EXPECT_EQ(FastMath::exp10(-40.0f), 0.0f);
+    EXPECT_EQ(FastMath::expm1(100.0f), 1e38f);
+    EXPECT_EQ(FastMath::expm1(-100.0f), -1.0f);
+    EXPECT_EQ(FastMath::log1p(-1.0f), -1e38f);
+    EXPECT_EQ(FastMath::log1p(-2.0f), -1e38f);
+}
+
 // Precision test for pow function
 TEST_F(FastMathTest, PowPrecisionTest)
 {
@@ -390,6 +642,116 @@ TEST_F(FastMathTest, PowPrecisionTest)
     EXPECT_LT(avg_rel_error, 0.01) << "Average relative error exceeds threshold";
 }
 
+// Precision test for pow with a fixed exponent (pow<N>, PowPlan, pow_batch)
+TEST_F(FastMathTest, PowPlanTest)
+{
+    const int num_samples = 5000;
+    const float exponents[] = {0.0f, 1.0f, 2.0f, 3.0f, -2.0f, 7.0f, 0.5f, 1.5f, -1.5f, -0.5f, 2.2f, 1.0f / 2.4f, -1.3f};
+
+    std::cout << "\n=== PowPlan Precision Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " bases in [0.1, 10] per exponent" << std::endl;
+
+    std::vector<float> bases(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        bases[i] = 0.1f + (10.0f * i / num_samples);
+    }
+
+    double max_rel_error_n = 0.0;
+    for (float base : bases)
+    {
+        const double errors[] = {
+            std::abs(FastMath::pow<3>(base) - std::pow(base, 3.0f)) / std::pow(base, 3.0f),
+            std::abs(FastMath::pow<-2>(base) - std::pow(base, -2.0f)) / std::pow(base, -2.0f),
+            std::abs(FastMath::pow<9>(base) - std::pow(base, 9.0f)) / std::pow(base, 9.0f),
+        };
+        for (double error : errors)
+        {
+            max_rel_error_n = std::max(max_rel_error_n, error);
+        }
+    }
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "pow<N> max relative error: " << max_rel_error_n << std::endl;
+    EXPECT_LT(max_rel_error_n, 1e-6);
+
+    std::vector<float> batch(num_samples);
+    std::vector<float> in_place(num_samples);
+    for (float exponent : exponents)
+    {
+        const FastMath::PowPlan plan(exponent);
+        EXPECT_EQ(plan.exponent(), exponent);
+        plan(bases.data(), batch.data(), bases.size());
+        in_place = bases;
+        FastMath::pow_batch(in_place.data(), in_place.data(), in_place.size(), exponent);
+
+        double max_scalar_error = 0.0;
+        double max_batch_error = 0.0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            const double expected = std::pow(static_cast<double>(bases[i]), static_cast<double>(exponent));
+            max_scalar_error = std::max(max_scalar_error, std::abs(plan(bases[i]) - expected) / expected);
+            max_batch_error = std::max(max_batch_error, std::abs(batch[i] - expected) / expected);
+            EXPECT_EQ(in_place[i], batch[i]) << "exponent=" << exponent << " base=" << bases[i];
+        }
+        std::cout << "exponent " << std::setw(10) << exponent << ": scalar " << max_scalar_error << ", batch "
+                  << max_batch_error << std::endl;
+
+        // Integer and half-integer exponents are exact up to a few roundings;
+        // the general kind shares pow()'s exp2/log2 error
+        const bool exact = exponent == std::floor(2.0f * exponent) / 2.0f;
+        const double tolerance = exact ? 2e-6 : 1e-5;
+        EXPECT_LT(max_scalar_error, tolerance) << "exponent=" << exponent;
+        EXPECT_LT(max_batch_error, tolerance) << "exponent=" << exponent;
+    }
+
+    // Zero and negative bases follow pow()
+    const float special_bases[] = {0.0f, -2.0f};
+    for (float exponent : {2.0f, -2.0f, 3.0f, 1.5f, -1.5f, 2.2f})
+    {
+        const FastMath::PowPlan plan(exponent);
+        float batch_out[2];
+        plan(special_bases, batch_out, 2);
+        for (int i = 0; i < 2; ++i)
+        {
+            const float expected = FastMath::pow(special_bases[i], exponent);
+            EXPECT_FLOAT_EQ(plan(special_bases[i]), expected) << "base=" << special_bases[i] << " exponent=" << exponent;
+            EXPECT_FLOAT_EQ(batch_out[i], expected) << "base=" << special_bases[i] << " exponent=" << exponent;
+        }
+    }
+    EXPECT_EQ(FastMath::pow<-1>(0.0f), 1e38f);
+
+    // Tiny bases with a negative half-integer exponent stay finite
+    EXPECT_NEAR(FastMath::PowPlan(-1.5f)(1e-20f), 1e30f, 1e24f);
+
+    // Negative integer exponents agree between the batch and scalar plan
+    // for extreme bases (compared on the bits: -ffast-math may fold NaN
+    // checks); x^|N| of 0 gives 1e38 and inf gives 0
+    const std::vector<float> extreme_bases = {1e20f, -1e20f, 1e-20f, -1e-20f, 1.0f, -1.0f, 0.0f, 2.0f, 3.0f, 0.1f};
+    std::vector<float> extreme_out(extreme_bases.size());
+    for (float exponent : {-1.0f, -2.0f, -3.0f, -7.0f, -32.0f})
+    {
+        const FastMath::PowPlan plan(exponent);
+        plan(extreme_bases.data(), extreme_out.data(), extreme_bases.size());
+        for (std::size_t i = 0; i < extreme_bases.size(); ++i)
+        {
+            const float scalar = plan(extreme_bases[i]);
+            std::uint32_t batch_bits;
+            std::uint32_t scalar_bits;
+            std::memcpy(&batch_bits, &extreme_out[i], sizeof(batch_bits));
+            std::memcpy(&scalar_bits, &scalar, sizeof(scalar_bits));
+            EXPECT_EQ(batch_bits, scalar_bits) << "exponent=" << exponent << " base=" << extreme_bases[i];
+            EXPECT_LT(batch_bits & 0x7FFFFFFFu, 0x7F800000u) << "exponent=" << exponent << " base=" << extreme_bases[i];
+        }
+        EXPECT_EQ(extreme_out[4], 1.0f) << "exponent=" << exponent;
+        EXPECT_EQ(extreme_out[6], 1e38f) << "exponent=" << exponent;
+        if (exponent <= -3.0f)
+        {
+            EXPECT_EQ(extreme_out[0], 0.0f) << "exponent=" << exponent;
+            EXPECT_EQ(extreme_out[2], 1e38f) << "exponent=" << exponent;
+        }
+    }
+}
+
 // Precision test for fmod function
 TEST_F(FastMathTest, FmodPrecisionTest)
 {
@@ -433,6 +795,121 @@ TEST_F(FastMathTest, FmodPrecisionTest)
     EXPECT_LT(avg_abs_error, 1e-7) << "Average absolute error exceeds threshold";
 }
 
+// Exactness test for fmod_batch, remainder_batch and wrap_angle
+TEST_F(FastMathTest, FmodBatchTest)
+{
+    const int num_samples = 20000;
+    const float divisors[] = {1.0f, 3.0f, 0.1f, -3.3f, 6.2831855f, 2.5e-3f, 123456.789f, 1e30f};
+
+    std::cout << "\n=== Fmod Batch Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " dividends in +-[1e-12, 1e38] per divisor" << std::endl;
+
+    // Log-uniform magnitudes, plus exact multiples and half-multiples of
+    // the divisor (zero remainders and remainder() ties)
+    std::mt19937 rng(2025);
+    std::uniform_real_distribution<float> exponent(-40.0f, 126.0f);
+    std::uniform_real_distribution<float> mantissa(1.0f, 2.0f);
+    std::vector<float> input(num_samples);
+    std::vector<float> output(num_samples);
+    std::vector<float> in_place(num_samples);
+
+    for (float divisor : divisors)
+    {
+        for (int i = 0; i < num_samples; ++i)
+        {
+            const float magnitude = std::ldexp(mantissa(rng), static_cast<int>(exponent(rng)));
+            input[i] = (i % 2 == 0) ? magnitude : -magnitude;
+            if (i % 50 == 0)
+            {
+                input[i] = divisor * static_cast<float>(i % 7);
+            }
+            if (i % 50 == 25)
+            {
+                input[i] = divisor * (static_cast<float>(i % 11) + 0.5f);
+            }
+        }
+
+        FastMath::fmod_batch(input.data(), output.data(), input.size(), divisor);
+        in_place = input;
+        FastMath::fmod_batch(in_place.data(), in_place.data(), in_place.size(), divisor);
+        int fmod_mismatches = 0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            fmod_mismatches += (output[i] != std::fmod(input[i], divisor)) ? 1 : 0;
+            EXPECT_EQ(in_place[i], output[i]) << "in-place fmod_batch, x=" << input[i] << " divisor=" << divisor;
+        }
+
+        FastMath::remainder_batch(input.data(), output.data(), input.size(), divisor);
+        int remainder_mismatches = 0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            remainder_mismatches += (output[i] != std::remainder(input[i], divisor)) ? 1 : 0;
+        }
+
+        std::cout << "  divisor " << divisor << ": fmod mismatches " << fmod_mismatches << ", remainder mismatches "
+                  << remainder_mismatches << std::endl;
+        EXPECT_EQ(fmod_mismatches, 0) << "divisor=" << divisor;
+        EXPECT_EQ(remainder_mismatches, 0) << "divisor=" << divisor;
+    }
+
+    // A zero divisor gives 0 like the scalar fmod
+    FastMath::fmod_batch(input.data(), output.data(), input.size(), 0.0f);
+    EXPECT_EQ(*std::max_element(output.begin(), output.end()), 0.0f);
+
+    // wrap_angle: [-pi, pi) against a double-precision reference
+    constexpr float pi = 3.14159265358979323846f;
+    double max_wrap_error = 0.0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        input[i] = -1e6f + (2e6f * i / num_samples);
+    }
+    input[0] = pi;
+    input[1] = -pi;
+    FastMath::wrap_angle(input.data(), output.data(), input.size());
+    for (int i = 0; i < num_samples; ++i)
+    {
+        const float scalar = FastMath::wrap_angle(input[i]);
+        EXPECT_GE(scalar, -pi);
+        EXPECT_LT(scalar, pi);
+        EXPECT_GE(output[i], -pi);
+        EXPECT_LT(output[i], pi);
+
+        double error = std::abs(scalar - std::remainder(static_cast<double>(input[i]), 2.0 * M_PI));
+        error = std::min(error, std::abs(error - 2.0 * M_PI)); // -pi and pi are the same angle
+        max_wrap_error = std::max(max_wrap_error, error);
+    }
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "wrap_angle max absolute error over [-1e6, 1e6]: " << max_wrap_error << std::endl;
+    EXPECT_LT(max_wrap_error, 3e-7);
+    EXPECT_NEAR(FastMath::wrap_angle(pi), static_cast<double>(pi) - 2.0 * M_PI, 1e-7); // float(pi) lies above pi
+
+    // Beyond the int range of the quotient: scalar and batch agree and stay in range
+    const std::vector<float> huge = {1e10f, 1e11f, -1e11f, 1e20f, std::numeric_limits<float>::max()};
+    std::vector<float> huge_wrapped(huge.size());
+    FastMath::wrap_angle(huge.data(), huge_wrapped.data(), huge.size());
+    for (std::size_t i = 0; i < huge.size(); ++i)
+    {
+        const float scalar = FastMath::wrap_angle(huge[i]);
+        EXPECT_GE(scalar, -pi) << "x=" << huge[i];
+        EXPECT_LT(scalar, pi) << "x=" << huge[i];
+        EXPECT_NEAR(huge_wrapped[i], scalar, 1e-5f) << "x=" << huge[i];
+    }
+
+    // Non-finite dividends give NaN like std::fmod (checked on the bits,
+    // since -ffast-math folds std::isnan)
+    const float infinity = std::numeric_limits<float>::infinity();
+    const std::vector<float> non_finite = {infinity, -infinity, 1.0f};
+    std::vector<float> non_finite_out(non_finite.size());
+    FastMath::fmod_batch(non_finite.data(), non_finite_out.data(), non_finite.size(), 3.0f);
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &non_finite_out[i], sizeof(bits));
+        EXPECT_GT(bits & 0x7FFFFFFFu, 0x7F800000u) << "fmod_batch(" << non_finite[i] << ", 3) is not NaN";
+    }
+    EXPECT_EQ(non_finite_out[2], 1.0f);
+}
+
 // Precision test for rounding functions
 TEST_F(FastMathTest, RoundingFunctionsPrecisionTest)
 {
@@ -839,6 +1316,98 @@ TEST_F(FastMathTest, TanPerformanceTest)
     std::cout << "Performance analysis: " << (speedup > 1.0 ? "FASTER" : "SLOWER") << " than std library" << std::endl;
 }
 
+// Performance test for asin function
+TEST_F(FastMathTest, AsinPerformanceTest)
+{
+    const int num_iterations = 1000000;
+    const float test_range = 1.0f;
+
+    std::vector<float> test_values;
+    test_values.reserve(num_iterations);
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        test_values.push_back(-test_range + (2.0f * test_range * i / num_iterations));
+    }
+
+    std::cout << "\n=== Asin Function Performance Test ===" << std::endl;
+    std::cout << "Testing " << num_iterations << " iterations" << std::endl;
+
+    // Fast math timing
+    auto start = std::chrono::high_resolution_clock::now();
+    volatile float fast_sum = 0.0f;
+    for (const auto &value : test_values)
+    {
+        fast_sum += FastMath::asin(value);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double fast_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    // Standard library timing
+    start = std::chrono::high_resolution_clock::now();
+    volatile float std_sum = 0.0f;
+    for (const auto &value : test_values)
+    {
+        std_sum += std::asin(value);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double std_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    double speedup = std_time / fast_time;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "FastMath::asin time: " << fast_time << " ms" << std::endl;
+    std::cout << "std::asin time: " << std_time << " ms" << std::endl;
+    std::cout << "Speedup: " << speedup << "x" << std::endl;
+
+    std::cout << "Performance analysis: " << (speedup > 1.0 ? "FASTER" : "SLOWER") << " than std library" << std::endl;
+}
+
+// Performance test for acos function
+TEST_F(FastMathTest, AcosPerformanceTest)
+{
+    const int num_iterations = 1000000;
+    const float test_range = 1.0f;
+
+    std::vector<float> test_values;
+    test_values.reserve(num_iterations);
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        test_values.push_back(-test_range + (2.0f * test_range * i / num_iterations));
+    }
+
+    std::cout << "\n=== Acos Function Performance Test ===" << std::endl;
+    std::cout << "Testing " << num_iterations << " iterations" << std::endl;
+
+    // Fast math timing
+    auto start = std::chrono::high_resolution_clock::now();
+    volatile float fast_sum = 0.0f;
+    for (const auto &value : test_values)
+    {
+        fast_sum += FastMath::acos(value);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double fast_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    // Standard library timing
+    start = std::chrono::high_resolution_clock::now();
+    volatile float std_sum = 0.0f;
+    for (const auto &value : test_values)
+    {
+        std_sum += std::acos(value);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double std_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    double speedup = std_time / fast_time;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "FastMath::acos time: " << fast_time << " ms" << std::endl;
+    std::cout << "std::acos time: " << std_time << " ms" << std::endl;
+    std::cout << "Speedup: " << speedup << "x" << std::endl;
+
+    std::cout << "Performance analysis: " << (speedup > 1.0 ? "FASTER" : "SLOWER") << " than std library" << std::endl;
+}
+
 // Performance test for atan2 function
 TEST_F(FastMathTest, Atan2PerformanceTest)
 {
@@ -1073,51 +1642,165 @@ TEST_F(FastMathTest, OptimizedPowPerformanceTest)
     std::cout << "Performance analysis: " << (speedup > 1.0 ? "FASTER" : "SLOWER") << " than std library" << std::endl;
 }
 
-// Performance test for fmod function
-TEST_F(FastMathTest, FmodPerformanceTest)
+// Performance test for pow with a loop-invariant exponent
+TEST_F(FastMathTest, PowPlanPerformanceTest)
 {
-    const int num_iterations = 1000000;
+    const int num_iterations = 500000;
+    const float gamma = 2.2f;
 
-    std::vector<std::pair<float, float>> test_values;
-    test_values.reserve(num_iterations);
+    std::vector<float> test_values(num_iterations);
     for (int i = 0; i < num_iterations; ++i)
     {
-        float dividend = -50.0f + (100.0f * i / num_iterations);
-        float divisor = 0.1f + (10.0f * ((i * 7) % num_iterations) / num_iterations);
-        test_values.push_back({dividend, divisor});
+        test_values[i] = 0.001f + (1.0f * i / num_iterations);
     }
+    std::vector<float> out(num_iterations);
 
-    std::cout << "\n=== Fmod Function Performance Test ===" << std::endl;
-    std::cout << "Testing " << num_iterations << " iterations" << std::endl;
+    std::cout << "\n=== PowPlan Performance Test ===" << std::endl;
+    std::cout << "Testing " << num_iterations << " iterations of x^" << gamma << std::endl;
 
-    // Fast math timing
+    // pow(x, e) per element
     auto start = std::chrono::high_resolution_clock::now();
-    volatile float fast_sum = 0.0f;
-    for (const auto &value : test_values)
+    for (int i = 0; i < num_iterations; ++i)
     {
-        fast_sum += FastMath::fmod(value.first, value.second);
+        out[i] = FastMath::pow(test_values[i], gamma);
     }
     auto end = std::chrono::high_resolution_clock::now();
-    double fast_time = std::chrono::duration<double, std::milli>(end - start).count();
+    double pow_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float pow_sink = out[num_iterations / 2];
+
+    // PowPlan batch
+    const FastMath::PowPlan plan(gamma);
+    start = std::chrono::high_resolution_clock::now();
+    plan(test_values.data(), out.data(), out.size());
+    end = std::chrono::high_resolution_clock::now();
+    double plan_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float plan_sink = out[num_iterations / 2];
 
     // Standard library timing
     start = std::chrono::high_resolution_clock::now();
-    volatile float std_sum = 0.0f;
-    for (const auto &value : test_values)
+    for (int i = 0; i < num_iterations; ++i)
     {
-        std_sum += std::fmod(value.first, value.second);
+        out[i] = std::pow(test_values[i], gamma);
     }
     end = std::chrono::high_resolution_clock::now();
     double std_time = std::chrono::duration<double, std::milli>(end - start).count();
-
-    double speedup = std_time / fast_time;
+    volatile float std_sink = out[num_iterations / 2];
+    (void)pow_sink;
+    (void)plan_sink;
+    (void)std_sink;
 
     std::cout << std::fixed << std::setprecision(2);
-    std::cout << "FastMath::fmod time: " << fast_time << " ms" << std::endl;
-    std::cout << "std::fmod time: " << std_time << " ms" << std::endl;
-    std::cout << "Speedup: " << speedup << "x" << std::endl;
-
-    std::cout << "Performance analysis: " << (speedup > 1.0 ? "FASTER" : "SLOWER") << " than std library" << std::endl;
+    std::cout << "FastMath::pow time: " << pow_time << " ms" << std::endl;
+    std::cout << "FastMath::PowPlan batch time: " << plan_time << " ms" << std::endl;
+    std::cout << "std::pow time: " << std_time << " ms" << std::endl;
+    std::cout << "PowPlan speedup vs std::pow: " << std_time / plan_time << "x" << std::endl;
+}
+
+// Performance test for fmod with one divisor (angle wrapping)
+TEST_F(FastMathTest, FmodBatchPerformanceTest)
+{
+    const int num_iterations = 500000;
+    const float two_pi = 6.28318548f;
+
+    std::vector<float> test_values(num_iterations);
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        test_values[i] = -1e4f + (2e4f * i / num_iterations);
+    }
+    std::vector<float> out(num_iterations);
+
+    std::cout << "\n=== Fmod Batch Performance Test ===" << std::endl;
+    std::cout << "Testing " << num_iterations << " iterations of fmod(x, 2*pi), |x| <= 1e4" << std::endl;
+
+    // Scalar fmod per element (std::fmod fallback above 25)
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        out[i] = FastMath::fmod(test_values[i], two_pi);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double fmod_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float fmod_sink = out[num_iterations / 2];
+
+    start = std::chrono::high_resolution_clock::now();
+    FastMath::fmod_batch(test_values.data(), out.data(), out.size(), two_pi);
+    end = std::chrono::high_resolution_clock::now();
+    double batch_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float batch_sink = out[num_iterations / 2];
+
+    start = std::chrono::high_resolution_clock::now();
+    FastMath::wrap_angle(test_values.data(), out.data(), out.size());
+    end = std::chrono::high_resolution_clock::now();
+    double wrap_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float wrap_sink = out[num_iterations / 2];
+
+    // Standard library timing
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        out[i] = std::fmod(test_values[i], two_pi);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double std_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float std_sink = out[num_iterations / 2];
+    (void)fmod_sink;
+    (void)batch_sink;
+    (void)wrap_sink;
+    (void)std_sink;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "FastMath::fmod time: " << fmod_time << " ms" << std::endl;
+    std::cout << "FastMath::fmod_batch time: " << batch_time << " ms" << std::endl;
+    std::cout << "FastMath::wrap_angle batch time: " << wrap_time << " ms" << std::endl;
+    std::cout << "std::fmod time: " << std_time << " ms" << std::endl;
+    std::cout << "fmod_batch speedup vs std::fmod: " << std_time / batch_time << "x" << std::endl;
+}
+
+// Performance test for fmod function
+TEST_F(FastMathTest, FmodPerformanceTest)
+{
+    const int num_iterations = 1000000;
+
+    std::vector<std::pair<float, float>> test_values;
+    test_values.reserve(num_iterations);
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        float dividend = -50.0f + (100.0f * i / num_iterations);
+        float divisor = 0.1f + (10.0f * ((i * 7) % num_iterations) / num_iterations);
+        test_values.push_back({dividend, divisor});
+    }
+
+    std::cout << "\n=== Fmod Function Performance Test ===" << std::endl;
+    std::cout << "Testing " << num_iterations << " iterations" << std::endl;
+
+    // Fast math timing
+    auto start = std::chrono::high_resolution_clock::now();
+    volatile float fast_sum = 0.0f;
+    for (const auto &value : test_values)
+    {
+        fast_sum += FastMath::fmod(value.first, value.second);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double fast_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    // Standard library timing
+    start = std::chrono::high_resolution_clock::now();
+    volatile float std_sum = 0.0f;
+    for (const auto &value : test_values)
+    {
+        std_sum += std::fmod(value.first, value.second);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double std_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    double speedup = std_time / fast_time;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "FastMath::fmod time: " << fast_time << " ms" << std::endl;
+    std::cout << "std::fmod time: " << std_time << " ms" << std::endl;
+    std::cout << "Speedup: " << speedup << "x" << std::endl;
+
+    std::cout << "Performance analysis: " << (speedup > 1.0 ? "FASTER" : "SLOWER") << " than std library" << std::endl;
 }
 
 // Performance test for rounding functions
@@ -1396,6 +2079,1191 @@ TEST_F(FastMathTest, AtanhPerformanceTest)
     std::cout << "Performance analysis: " << (speedup > 1.0 ? "FASTER" : "SLOWER") << " than std library" << std::endl;
 }
 
+// Runtime ISA dispatch test
+TEST_F(FastMathTest, IsaDispatchTest)
+{
+    const char *names[] = {"generic", "avx2", "avx512"};
+    FastMath::Isa isa = FastMath::active_isa();
+
+    std::cout << "\n=== ISA Dispatch Test ===" << std::endl;
+    std::cout << "Active batch ISA: " << names[static_cast<int>(isa)] << std::endl;
+
+    // The environment cap must be honored
+    const char *requested = std::getenv("FAST_MATH_ISA");
+    if (requested != nullptr && std::string(requested) == "generic")
+    {
+        EXPECT_EQ(isa, FastMath::Isa::Generic);
+    }
+    else if (requested != nullptr && std::string(requested) == "avx2")
+    {
+        EXPECT_NE(isa, FastMath::Isa::AVX512);
+    }
+
+    // Repeated queries return the tier bound on first use
+    EXPECT_EQ(FastMath::active_isa(), isa);
+}
+
+#if defined(FAST_MATH_VECTOR_ABI) && defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+// SSE2 (4-lane) vector-ABI variants exported by the library
+extern "C" __m128 fast_math_exp_b4(__m128) __asm__("_ZGVbN4v__ZN8FastMath3expEf");
+extern "C" __m128 fast_math_log_b4(__m128) __asm__("_ZGVbN4v__ZN8FastMath3logEf");
+extern "C" __m128 fast_math_atan_b4(__m128) __asm__("_ZGVbN4v__ZN8FastMath4atanEf");
+extern "C" __m128 fast_math_atan2_b4(__m128, __m128) __asm__("_ZGVbN4vv__ZN8FastMath5atan2Eff");
+
+// Vector-ABI variants must be callable by their libmvec-style names and agree with the scalar API
+TEST_F(FastMathTest, VectorAbiTest)
+{
+    std::cout << "\n=== Vector ABI Test ===" << std::endl;
+
+    alignas(16) float x[4] = {-2.0f, 0.5f, 1.0f, 10.0f};
+    alignas(16) float y[4] = {1.0f, -3.0f, 0.25f, 7.0f};
+    alignas(16) float result[4];
+
+    _mm_store_ps(result, fast_math_exp_b4(_mm_load_ps(x)));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_FLOAT_EQ(result[i], FastMath::exp(x[i])) << "_ZGVbN4v_ exp lane " << i;
+    }
+
+    _mm_store_ps(result, fast_math_log_b4(_mm_load_ps(y)));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_FLOAT_EQ(result[i], FastMath::log(y[i])) << "_ZGVbN4v_ log lane " << i;
+    }
+
+    _mm_store_ps(result, fast_math_atan_b4(_mm_load_ps(x)));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_FLOAT_EQ(result[i], FastMath::atan(x[i])) << "_ZGVbN4v_ atan lane " << i;
+    }
+
+    _mm_store_ps(result, fast_math_atan2_b4(_mm_load_ps(y), _mm_load_ps(x)));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_FLOAT_EQ(result[i], FastMath::atan2(y[i], x[i])) << "_ZGVbN4vv_ atan2 lane " << i;
+    }
+
+    // A plain loop over the scalar API; the compiler may call the vector variants here
+    const int num_samples = 1003;
+    std::vector<float> input(num_samples);
+    std::vector<float> output(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        input[i] = -10.0f + (20.0f * i / num_samples);
+    }
+    for (int i = 0; i < num_samples; ++i)
+    {
+        output[i] = FastMath::tanh(input[i]);
+    }
+
+    float (*volatile scalar_tanh)(float) = FastMath::tanh;
+    double max_error = 0.0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        max_error = std::max(max_error, static_cast<double>(std::abs(output[i] - scalar_tanh(input[i]))));
+    }
+    std::cout << "Vectorized loop tanh max deviation from scalar: " << max_error << std::endl;
+    EXPECT_LT(max_error, 1e-6);
+}
+#endif
+
+// Batch API consistency test: every batch entry point must agree with its scalar counterpart
+TEST_F(FastMathTest, BatchConsistencyTest)
+{
+    const int num_samples = 1003; // Odd size to exercise remainder handling
+
+    using UnaryScalar = float (*)(float);
+    using UnaryBatch = void (*)(const float *, float *, std::size_t);
+    struct UnaryCase
+    {
+        const char *name;
+        UnaryScalar scalar;
+        UnaryBatch batch;
+        float min_value;
+        float max_value;
+    };
+
+    const std::vector<UnaryCase> unary_cases = {
+        {"sin", FastMath::sin, FastMath::sin, -10.0f, 10.0f},
+        {"cos", FastMath::cos, FastMath::cos, -10.0f, 10.0f},
+        {"sqrt", FastMath::sqrt, FastMath::sqrt, 0.001f, 1000.0f},
+        {"rsqrt", FastMath::rsqrt, FastMath::rsqrt, 0.001f, 1000.0f},
+        {"tan", FastMath::tan, FastMath::tan, -1.4f, 1.4f},
+        {"asin", FastMath::asin, FastMath::asin, -0.99f, 0.99f},
+        {"acos", FastMath::acos, FastMath::acos, -0.99f, 0.99f},
+        {"atan", FastMath::atan, FastMath::atan, -50.0f, 50.0f},
+        {"wrap_angle", FastMath::wrap_angle, FastMath::wrap_angle, -100.0f, 100.0f},
+        {"exp", FastMath::exp, FastMath::exp, -10.0f, 10.0f},
+        {"exp2", FastMath::exp2, FastMath::exp2, -10.0f, 10.0f},
+        {"exp10", FastMath::exp10, FastMath::exp10, -3.0f, 3.0f},
+        {"expm1", FastMath::expm1, FastMath::expm1, -10.0f, 10.0f},
+        {"log", FastMath::log, FastMath::log, 0.01f, 100.0f},
+        {"log10", FastMath::log10, FastMath::log10, 0.01f, 100.0f},
+        {"log2", FastMath::log2, FastMath::log2, 0.01f, 100.0f},
+        {"log1p", FastMath::log1p, FastMath::log1p, -0.99f, 100.0f},
+        {"ceil", FastMath::ceil, FastMath::ceil, -100.0f, 100.0f},
+        {"floor", FastMath::floor, FastMath::floor, -100.0f, 100.0f},
+        {"round", FastMath::round, FastMath::round, -100.0f, 100.0f},
+        {"sinh", FastMath::sinh, FastMath::sinh, -5.0f, 5.0f},
+        {"cosh", FastMath::cosh, FastMath::cosh, -5.0f, 5.0f},
+        {"tanh", FastMath::tanh, FastMath::tanh, -5.0f, 5.0f},
+        {"asinh", FastMath::asinh, FastMath::asinh, -10.0f, 10.0f},
+        {"acosh", FastMath::acosh, FastMath::acosh, 1.0f, 10.0f},
+        {"atanh", FastMath::atanh, FastMath::atanh, -0.99f, 0.99f},
+    };
+
+    std::cout << "\n=== Batch API Consistency Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples per function" << std::endl;
+
+    std::vector<float> input(num_samples);
+    std::vector<float> output(num_samples);
+
+    for (const auto &c : unary_cases)
+    {
+        for (int i = 0; i < num_samples; ++i)
+        {
+            input[i] = c.min_value + ((c.max_value - c.min_value) * i / num_samples);
+        }
+        c.batch(input.data(), output.data(), input.size());
+
+        double max_rel_error = 0.0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            float expected = c.scalar(input[i]);
+            double error = std::abs(output[i] - expected) / std::max(1.0f, std::abs(expected));
+            max_rel_error = std::max(max_rel_error, error);
+        }
+
+        std::cout << std::scientific << std::setprecision(2);
+        std::cout << "  " << c.name << " max deviation from scalar: " << max_rel_error << std::endl;
+        EXPECT_LT(max_rel_error, 1e-4) << c.name << " batch result deviates from scalar";
+    }
+
+    using BinaryScalar = float (*)(float, float);
+    using BinaryBatch = void (*)(const float *, const float *, float *, std::size_t);
+    struct BinaryCase
+    {
+        const char *name;
+        BinaryScalar scalar;
+        BinaryBatch batch;
+    };
+
+    const std::vector<BinaryCase> binary_cases = {
+        {"atan2", FastMath::atan2, FastMath::atan2},
+        {"pow", FastMath::pow, FastMath::pow},
+        {"fmod", FastMath::fmod, FastMath::fmod},
+    };
+
+    std::vector<float> first(num_samples);
+    std::vector<float> second(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        first[i] = 0.1f + (10.0f * i / num_samples);
+        second[i] = -3.0f + (6.0f * ((i * 7) % num_samples) / num_samples);
+    }
+
+    for (const auto &c : binary_cases)
+    {
+        c.batch(first.data(), second.data(), output.data(), output.size());
+
+        double max_rel_error = 0.0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            float expected = c.scalar(first[i], second[i]);
+            double error = std::abs(output[i] - expected) / std::max(1.0f, std::abs(expected));
+            max_rel_error = std::max(max_rel_error, error);
+        }
+
+        std::cout << "  " << c.name << " max deviation from scalar: " << max_rel_error << std::endl;
+        EXPECT_LT(max_rel_error, 1e-4) << c.name << " batch result deviates from scalar";
+    }
+
+    // In-place operation must be supported
+    std::vector<float> in_place(input);
+    FastMath::exp(in_place.data(), in_place.data(), in_place.size());
+    FastMath::exp(input.data(), output.data(), input.size());
+    EXPECT_EQ(in_place, output) << "In-place batch result differs";
+
+    // Zero-length calls are no-ops
+    FastMath::sin(nullptr, nullptr, 0);
+}
+
+// Precision test for batch sin/cos over a wide range (exercises vectorized range reduction)
+TEST_F(FastMathTest, BatchSinCosPrecisionTest)
+{
+    const int num_samples = 100003;
+    const float test_range = 1000.0f;
+
+    std::vector<float> angles(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        angles[i] = -test_range + (2.0f * test_range * i / num_samples);
+    }
+    std::vector<float> sin_values(num_samples);
+    std::vector<float> cos_values(num_samples);
+    FastMath::sin(angles.data(), sin_values.data(), angles.size());
+    FastMath::cos(angles.data(), cos_values.data(), angles.size());
+
+    std::cout << "\n=== Batch Sin/Cos Precision Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples in range [-1000, 1000]" << std::endl;
+
+    double max_sin_error = 0.0;
+    double max_cos_error = 0.0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        max_sin_error = std::max(max_sin_error, std::abs(sin_values[i] - std::sin(static_cast<double>(angles[i]))));
+        max_cos_error = std::max(max_cos_error, std::abs(cos_values[i] - std::cos(static_cast<double>(angles[i]))));
+    }
+
+    std::cout << std::fixed << std::setprecision(8);
+    std::cout << "Sin max absolute error: " << max_sin_error << std::endl;
+    std::cout << "Cos max absolute error: " << max_cos_error << std::endl;
+
+    EXPECT_LT(max_sin_error, 0.0012) << "Batch sin max absolute error exceeds threshold";
+    EXPECT_LT(max_cos_error, 0.0012) << "Batch cos max absolute error exceeds threshold";
+
+    // Beyond 1e3 a float-only reduction drifts away from the scalar path;
+    // log-spaced magnitudes up to 1e9, both signs
+    const int num_large = 4003;
+    std::vector<float> large(num_large);
+    for (int i = 0; i < num_large; ++i)
+    {
+        const float magnitude = static_cast<float>(std::pow(10.0, 3.0 + 6.0 * i / (num_large - 1)));
+        large[i] = (i % 2) ? -magnitude : magnitude;
+    }
+    std::vector<float> large_sin(num_large);
+    std::vector<float> large_cos(num_large);
+    std::vector<float> fused_sin(num_large);
+    std::vector<float> fused_cos(num_large);
+    FastMath::sin(large.data(), large_sin.data(), large.size());
+    FastMath::cos(large.data(), large_cos.data(), large.size());
+    FastMath::sincos(large.data(), fused_sin.data(), fused_cos.data(), large.size());
+
+    max_sin_error = 0.0;
+    max_cos_error = 0.0;
+    for (int i = 0; i < num_large; ++i)
+    {
+        const double x = large[i];
+        max_sin_error = std::max(max_sin_error, std::abs(large_sin[i] - std::sin(x)));
+        max_cos_error = std::max(max_cos_error, std::abs(large_cos[i] - std::cos(x)));
+        EXPECT_NEAR(large_sin[i], FastMath::sin(large[i]), 1e-5f) << "angle " << large[i];
+        EXPECT_NEAR(large_cos[i], FastMath::cos(large[i]), 1e-5f) << "angle " << large[i];
+        EXPECT_NEAR(fused_sin[i], FastMath::sin(large[i]), 1e-5f) << "angle " << large[i];
+        EXPECT_NEAR(fused_cos[i], FastMath::cos(large[i]), 1e-5f) << "angle " << large[i];
+    }
+
+    std::cout << "Sin max absolute error up to 1e9: " << max_sin_error << std::endl;
+    std::cout << "Cos max absolute error up to 1e9: " << max_cos_error << std::endl;
+
+    EXPECT_LT(max_sin_error, 0.0012) << "Batch sin loses accuracy for large arguments";
+    EXPECT_LT(max_cos_error, 0.0012) << "Batch cos loses accuracy for large arguments";
+}
+
+// sincos must match separate sin/cos calls, scalar and batch
+TEST_F(FastMathTest, BatchSinCosFusedTest)
+{
+    const int num_samples = 1003;
+    const float test_range = 100.0f;
+
+    std::vector<float> angles(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        angles[i] = -test_range + (2.0f * test_range * i / num_samples);
+    }
+
+    std::cout << "\n=== Fused SinCos Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples in range [-100, 100]" << std::endl;
+
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float s;
+        float c;
+        FastMath::sincos(angles[i], &s, &c);
+        EXPECT_EQ(s, FastMath::sin(angles[i])) << "angle " << angles[i];
+        EXPECT_EQ(c, FastMath::cos(angles[i])) << "angle " << angles[i];
+    }
+
+    std::vector<float> expected_sin(num_samples);
+    std::vector<float> expected_cos(num_samples);
+    FastMath::sin(angles.data(), expected_sin.data(), angles.size());
+    FastMath::cos(angles.data(), expected_cos.data(), angles.size());
+
+    std::vector<float> sin_values(num_samples);
+    std::vector<float> cos_values(num_samples);
+    FastMath::sincos(angles.data(), sin_values.data(), cos_values.data(), angles.size());
+    for (int i = 0; i < num_samples; ++i)
+    {
+        EXPECT_EQ(sin_values[i], expected_sin[i]) << "angle " << angles[i];
+        EXPECT_EQ(cos_values[i], expected_cos[i]) << "angle " << angles[i];
+    }
+
+    // sin_out may alias the input
+    std::vector<float> in_place = angles;
+    FastMath::sincos(in_place.data(), in_place.data(), cos_values.data(), in_place.size());
+    for (int i = 0; i < num_samples; ++i)
+    {
+        EXPECT_EQ(in_place[i], expected_sin[i]) << "angle " << angles[i];
+    }
+
+    // Fused call against two separate batch calls
+    const int num_iterations = 1000000;
+    std::vector<float> headings(num_iterations);
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        headings[i] = -test_range + (2.0f * test_range * i / num_iterations);
+    }
+    std::vector<float> sin_buffer(num_iterations);
+    std::vector<float> cos_buffer(num_iterations);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    FastMath::sin(headings.data(), sin_buffer.data(), headings.size());
+    FastMath::cos(headings.data(), cos_buffer.data(), headings.size());
+    auto end = std::chrono::high_resolution_clock::now();
+    double separate_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    FastMath::sincos(headings.data(), sin_buffer.data(), cos_buffer.data(), headings.size());
+    end = std::chrono::high_resolution_clock::now();
+    double fused_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Separate sin + cos batch time: " << separate_time << " ms" << std::endl;
+    std::cout << "Fused sincos batch time: " << fused_time << " ms" << std::endl;
+    std::cout << "Speedup: " << separate_time / fused_time << "x" << std::endl;
+}
+
+// Range reduction must keep sin/cos accurate for large accumulated angles
+TEST_F(FastMathTest, LargeArgumentSinCosTest)
+{
+    const int num_samples = 100003;
+    const float test_range = 100000.0f;
+
+    std::cout << "\n=== Large Argument Sin/Cos Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples in range [-100000, 100000]" << std::endl;
+
+    double max_sin_error = 0.0;
+    double max_cos_error = 0.0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float x = -test_range + (2.0f * test_range * i / num_samples);
+        max_sin_error = std::max(max_sin_error, std::abs(FastMath::sin(x) - std::sin(static_cast<double>(x))));
+        max_cos_error = std::max(max_cos_error, std::abs(FastMath::cos(x) - std::cos(static_cast<double>(x))));
+    }
+
+    std::cout << std::fixed << std::setprecision(8);
+    std::cout << "Sin max absolute error: " << max_sin_error << std::endl;
+    std::cout << "Cos max absolute error: " << max_cos_error << std::endl;
+
+    EXPECT_LT(max_sin_error, 0.0012) << "Sin max absolute error exceeds threshold for large arguments";
+    EXPECT_LT(max_cos_error, 0.0012) << "Cos max absolute error exceeds threshold for large arguments";
+
+    // Past the int range of k (|x| > 1.35e10) up to FLT_MAX: accurate to
+    // 1e11, and at least bounded beyond unless FAST_MATH_PAYNE_HANEK is set
+    const float pi = 3.14159265358979323846f;
+    const float max_float = std::numeric_limits<float>::max();
+    const std::vector<float> huge = {1e9f, -1e9f, 1e11f, -1e11f, 1e20f, max_float, -max_float};
+    std::vector<float> batch_sin(huge.size());
+    std::vector<float> batch_cos(huge.size());
+    std::vector<float> fused_sin(huge.size());
+    std::vector<float> fused_cos(huge.size());
+    std::vector<float> batch_wrap(huge.size());
+    FastMath::sin(huge.data(), batch_sin.data(), huge.size());
+    FastMath::cos(huge.data(), batch_cos.data(), huge.size());
+    FastMath::sincos(huge.data(), fused_sin.data(), fused_cos.data(), huge.size());
+    FastMath::wrap_angle(huge.data(), batch_wrap.data(), huge.size());
+
+    for (std::size_t i = 0; i < huge.size(); ++i)
+    {
+        const float x = huge[i];
+        const float values[] = {FastMath::sin(x), FastMath::cos(x), FastMath::sin<FastMath::Precision::High>(x),
+                                FastMath::cos<FastMath::Precision::High>(x), batch_sin[i], batch_cos[i],
+                                fused_sin[i], fused_cos[i]};
+        for (float value : values)
+        {
+            EXPECT_LE(std::abs(value), 1.001f) << "angle " << x;
+        }
+        EXPECT_LE(std::abs(FastMath::tan(x)), 1e7f) << "angle " << x;
+        const float wrapped[] = {FastMath::wrap_angle(x), batch_wrap[i]};
+        for (float value : wrapped)
+        {
+            EXPECT_GE(value, -pi) << "angle " << x;
+            EXPECT_LT(value, pi) << "angle " << x;
+        }
+
+#ifndef FAST_MATH_PAYNE_HANEK
+        if (std::abs(x) > 1e11f)
+        {
+            continue;
+        }
+#endif
+        const double reference_sin = std::sin(static_cast<double>(x));
+        const double reference_cos = std::cos(static_cast<double>(x));
+        EXPECT_NEAR(FastMath::sin(x), reference_sin, 0.0012) << "angle " << x;
+        EXPECT_NEAR(FastMath::cos(x), reference_cos, 0.0012) << "angle " << x;
+        EXPECT_NEAR(FastMath::sin<FastMath::Precision::High>(x), reference_sin, 1e-5) << "angle " << x;
+        EXPECT_NEAR(FastMath::cos<FastMath::Precision::High>(x), reference_cos, 1e-5) << "angle " << x;
+        EXPECT_NEAR(batch_sin[i], FastMath::sin(x), 1e-5f) << "angle " << x;
+        EXPECT_NEAR(batch_cos[i], FastMath::cos(x), 1e-5f) << "angle " << x;
+        EXPECT_NEAR(fused_sin[i], FastMath::sin(x), 1e-5f) << "angle " << x;
+        EXPECT_NEAR(fused_cos[i], FastMath::cos(x), 1e-5f) << "angle " << x;
+        EXPECT_NEAR(batch_wrap[i], FastMath::wrap_angle(x), 1e-5f) << "angle " << x;
+    }
+}
+
+// Batch exp/log/pow special values must follow the scalar conventions
+TEST_F(FastMathTest, BatchSpecialValuesTest)
+{
+    std::cout << "\n=== Batch Special Values Test ===" << std::endl;
+
+    const std::vector<float> exp_values = {-100.0f, -87.5f, -1.0f, 0.0f, 1.0f, 88.5f, 100.0f};
+    std::vector<float> exp_results(exp_values.size());
+    FastMath::exp(exp_values.data(), exp_results.data(), exp_values.size());
+    for (std::size_t i = 0; i < exp_values.size(); ++i)
+    {
+        float expected = FastMath::exp(exp_values[i]);
+        EXPECT_NEAR(exp_results[i], expected, 1e-6f * std::max(1.0f, std::abs(expected)))
+            << "exp(" << exp_values[i] << ")";
+    }
+
+    const std::vector<float> log_values = {-1.0f, 0.0f, 1.0f, 1e-30f, 1e30f};
+    std::vector<float> log_results(log_values.size());
+    FastMath::log(log_values.data(), log_results.data(), log_values.size());
+    for (std::size_t i = 0; i < log_values.size(); ++i)
+    {
+        float expected = FastMath::log(log_values[i]);
+        EXPECT_NEAR(log_results[i], expected, 1e-5f * std::max(1.0f, std::abs(expected)))
+            << "log(" << log_values[i] << ")";
+    }
+
+    const std::vector<std::pair<float, float>> pow_values = {
+        {2.0f, 0.0f}, {2.0f, 1.0f}, {0.0f, 2.0f}, {0.0f, -1.0f}, {1.0f, 7.5f},
+        {-2.0f, 3.0f}, {-2.0f, 4.0f}, {-2.0f, -3.0f}, {-2.0f, 0.5f}, {3.0f, 32.0f},
+        {2.0f, -32.0f}, {10.0f, 0.5f}, {4.0f, -0.5f}, {1.5f, 40.0f},
+        // ±2^31: the integer conversion gives INT32_MIN, which is not small
+        {2.0f, -2147483648.0f}, {0.5f, -2147483648.0f}, {2.0f, 2147483648.0f}, {0.5f, 2147483648.0f}};
+    std::vector<float> bases;
+    std::vector<float> exponents;
+    for (const auto &value : pow_values)
+    {
+        bases.push_back(value.first);
+        exponents.push_back(value.second);
+    }
+    std::vector<float> pow_results(pow_values.size());
+    FastMath::pow(bases.data(), exponents.data(), pow_results.data(), pow_values.size());
+    for (std::size_t i = 0; i < pow_values.size(); ++i)
+    {
+        float expected = FastMath::pow(bases[i], exponents[i]);
+        EXPECT_NEAR(pow_results[i], expected, 1e-4f * std::max(1.0f, std::abs(expected)))
+            << "pow(" << bases[i] << ", " << exponents[i] << ")";
+    }
+
+    // Negative integer powers that overflow or underflow match the scalar
+    // pow exactly (compared on the bits: -ffast-math may fold NaN checks)
+    const float extreme_bases[] = {1e20f, 1e-20f, -1e20f, 2.0f, 3.0f, 0.1f, 7.0f, 1e-5f, 1e5f};
+    for (float exponent : {-1.0f, -3.0f, -32.0f})
+    {
+        std::vector<float> extreme_exponents(std::size(extreme_bases), exponent);
+        std::vector<float> extreme_results(std::size(extreme_bases));
+        FastMath::pow(extreme_bases, extreme_exponents.data(), extreme_results.data(), extreme_results.size());
+        for (std::size_t i = 0; i < extreme_results.size(); ++i)
+        {
+            const float expected = FastMath::pow(extreme_bases[i], exponent);
+            std::uint32_t bits;
+            std::uint32_t expected_bits;
+            std::memcpy(&bits, &extreme_results[i], sizeof(bits));
+            std::memcpy(&expected_bits, &expected, sizeof(expected_bits));
+            EXPECT_EQ(bits, expected_bits) << "pow(" << extreme_bases[i] << ", " << exponent << ")";
+        }
+    }
+}
+
+// Batch sqrt/rsqrt special values and 2D/3D normalization
+TEST_F(FastMathTest, BatchNormalizeTest)
+{
+    const std::vector<float> values = {-1.0f, -0.0f, 0.0f, 1e-40f, 1.17549435e-38f, 0.25f, 2.0f, 1e30f, 3e38f};
+    std::vector<float> results(values.size());
+    FastMath::sqrt(values.data(), results.data(), values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        // Subnormal inputs give 0 in the vector kernels only
+        if (values[i] > 0.0f && values[i] < 1.17549435e-38f)
+        {
+            continue;
+        }
+        const float expected = FastMath::sqrt(values[i]);
+        EXPECT_NEAR(results[i], expected, 3e-7f * expected) << "sqrt(" << values[i] << ")";
+    }
+    // +inf passes through like the scalar sqrt (x * rsqrt(x) alone is inf * 0);
+    // compared on the bits, since -ffast-math may fold comparisons with inf
+    const std::vector<float> infinite(9, std::numeric_limits<float>::infinity());
+    std::vector<float> infinite_roots(infinite.size());
+    FastMath::sqrt(infinite.data(), infinite_roots.data(), infinite.size());
+    for (float root : infinite_roots)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &root, sizeof(bits));
+        EXPECT_EQ(bits, 0x7F800000u) << "sqrt(+inf)";
+    }
+    FastMath::rsqrt(values.data(), results.data(), values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        const float expected = FastMath::rsqrt(values[i]);
+        EXPECT_NEAR(results[i], expected, 5e-7f * expected) << "rsqrt(" << values[i] << ")";
+    }
+
+    // Sizes around the 8- and 16-lane blocks, plus zero and tiny vectors
+    for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(17), std::size_t(1003)})
+    {
+        std::vector<float> x(n);
+        std::vector<float> y(n);
+        std::vector<float> z(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const float scale = std::pow(10.0f, static_cast<float>(i % 31) - 15.0f);
+            x[i] = scale * std::cos(0.37f * i);
+            y[i] = scale * std::sin(0.37f * i);
+            z[i] = scale * (static_cast<float>(i % 5) - 2.0f);
+        }
+        if (n > 3)
+        {
+            x[3] = y[3] = z[3] = 0.0f;
+            x[2] = y[2] = z[2] = 1e-25f;
+        }
+
+        std::vector<float> out_x(n);
+        std::vector<float> out_y(n);
+        std::vector<float> out_z(n);
+        FastMath::normalize(x.data(), y.data(), out_x.data(), out_y.data(), n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double length = std::hypot(static_cast<double>(x[i]), static_cast<double>(y[i]));
+            if (length * length < 1.17549435e-38)
+            {
+                EXPECT_EQ(out_x[i], 0.0f) << "2D tiny vector " << i;
+                EXPECT_EQ(out_y[i], 0.0f) << "2D tiny vector " << i;
+                continue;
+            }
+            EXPECT_NEAR(out_x[i], x[i] / length, 1e-6) << "2D x at " << i;
+            EXPECT_NEAR(out_y[i], y[i] / length, 1e-6) << "2D y at " << i;
+        }
+
+        // In place
+        FastMath::normalize(x.data(), y.data(), z.data(), x.data(), y.data(), z.data(), n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double length_squared = static_cast<double>(x[i]) * x[i] + static_cast<double>(y[i]) * y[i] +
+                                          static_cast<double>(z[i]) * z[i];
+            if (length_squared != 0.0)
+            {
+                EXPECT_NEAR(length_squared, 1.0, 2e-6) << "3D length at " << i;
+            }
+        }
+        if (n > 3)
+        {
+            EXPECT_EQ(x[2], 0.0f);
+            EXPECT_EQ(x[3], 0.0f);
+        }
+    }
+}
+
+// Performance test for batch normalize against the division-based loop
+TEST_F(FastMathTest, NormalizePerformanceTest)
+{
+    const std::size_t n = 1 << 20;
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    std::vector<float> z(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = std::cos(0.001f * i) * (1.0f + i % 7);
+        y[i] = std::sin(0.001f * i) * (1.0f + i % 3);
+        z[i] = 0.5f - static_cast<float>(i % 11);
+    }
+    std::vector<float> out_x(n);
+    std::vector<float> out_y(n);
+    std::vector<float> out_z(n);
+
+    std::cout << "\n=== Normalize Performance Test ===" << std::endl;
+    std::cout << "Testing " << n << " 3D vectors" << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const float length = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        out_x[i] = x[i] / length;
+        out_y[i] = y[i] / length;
+        out_z[i] = z[i] / length;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double std_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    FastMath::normalize(x.data(), y.data(), z.data(), out_x.data(), out_y.data(), out_z.data(), n);
+    end = std::chrono::high_resolution_clock::now();
+    double fast_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float sink = out_x[n / 2];
+    (void)sink;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "FastMath::normalize time: " << fast_time << " ms" << std::endl;
+    std::cout << "std::sqrt + division time: " << std_time << " ms" << std::endl;
+    std::cout << "Speedup: " << std_time / fast_time << "x" << std::endl;
+}
+
+// Performance test for batch API against per-element scalar calls
+TEST_F(FastMathTest, BatchPerformanceTest)
+{
+    const int num_iterations = 1000000;
+    const float test_range = 2.0f * M_PI;
+
+    std::vector<float> test_values;
+    test_values.reserve(num_iterations);
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        test_values.push_back(-test_range + (2.0f * test_range * i / num_iterations));
+    }
+    std::vector<float> results(num_iterations);
+
+    std::cout << "\n=== Batch API Performance Test ===" << std::endl;
+    std::cout << "Testing " << num_iterations << " iterations" << std::endl;
+
+    using UnaryScalar = float (*)(float);
+    using UnaryBatch = void (*)(const float *, float *, std::size_t);
+    const std::vector<std::tuple<const char *, UnaryScalar, UnaryBatch>> cases = {
+        {"sin", FastMath::sin, FastMath::sin},
+        {"cos", FastMath::cos, FastMath::cos},
+        {"exp", FastMath::exp, FastMath::exp},
+        {"log", FastMath::log, FastMath::log},
+        {"tanh", FastMath::tanh, FastMath::tanh},
+    };
+
+    for (const auto &c : cases)
+    {
+        // Per-element scalar calls
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < num_iterations; ++i)
+        {
+            results[i] = std::get<1>(c)(test_values[i]);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        double scalar_time = std::chrono::duration<double, std::milli>(end - start).count();
+        volatile float scalar_sink = results[num_iterations / 2];
+        (void)scalar_sink;
+
+        // Single batch call
+        start = std::chrono::high_resolution_clock::now();
+        std::get<2>(c)(test_values.data(), results.data(), results.size());
+        end = std::chrono::high_resolution_clock::now();
+        double batch_time = std::chrono::duration<double, std::milli>(end - start).count();
+        volatile float batch_sink = results[num_iterations / 2];
+        (void)batch_sink;
+
+        double speedup = scalar_time / batch_time;
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "FastMath::" << std::get<0>(c) << " scalar loop time: " << scalar_time << " ms" << std::endl;
+        std::cout << "FastMath::" << std::get<0>(c) << " batch time: " << batch_time << " ms" << std::endl;
+        std::cout << "Speedup: " << speedup << "x" << std::endl;
+    }
+}
+
+// Parallel transforms must match a single batch call exactly, whatever the
+// split into chunks and however the chunks are stolen
+TEST_F(FastMathTest, ParallelTransformTest)
+{
+    const std::size_t n = 100003; // Not a multiple of any chunk size below
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = -10.0f + 20.0f * static_cast<float>(i) / n;
+        y[i] = 5.0f - 7.0f * static_cast<float>(i) / n;
+    }
+
+    std::vector<float> expected(n);
+    std::vector<float> actual(n);
+
+    // More participants than cores, so tasks are also stolen from sleeping threads
+    FastMath::parallel::ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    for (std::size_t chunk : {std::size_t(1000), std::size_t(4096), FastMath::parallel::default_chunk, n})
+    {
+        FastMath::exp(x.data(), expected.data(), n);
+        std::fill(actual.begin(), actual.end(), -1.0f);
+        FastMath::parallel::transform(pool, x.data(), actual.data(), n, FastMath::op::exp, chunk);
+        EXPECT_EQ(expected, actual) << "exp, chunk " << chunk;
+
+        FastMath::atan2(y.data(), x.data(), expected.data(), n);
+        std::fill(actual.begin(), actual.end(), -1.0f);
+        FastMath::parallel::transform(pool, y.data(), x.data(), actual.data(), n, FastMath::op::atan2, chunk);
+        EXPECT_EQ(expected, actual) << "atan2, chunk " << chunk;
+    }
+
+    // Any batch-shaped callable works, and loops started from a task run inline
+    std::vector<float> nested(n, 0.0f);
+    FastMath::parallel::transform(pool, x.data(), actual.data(), n,
+                                  [&](const float *in, float *out, std::size_t count) {
+                                      const std::size_t offset = in - x.data();
+                                      FastMath::parallel::transform(pool, in, nested.data() + offset, count,
+                                                                    FastMath::op::sin, 100);
+                                      std::copy(nested.begin() + offset, nested.begin() + offset + count, out);
+                                  });
+    FastMath::sin(x.data(), expected.data(), n);
+    EXPECT_EQ(expected, actual);
+
+    // Empty and single-chunk arrays
+    FastMath::parallel::transform(pool, x.data(), actual.data(), 0, FastMath::op::exp);
+    FastMath::parallel::transform(FastMath::parallel::default_pool(), x.data(), actual.data(), 10, FastMath::op::log);
+    FastMath::log(x.data(), expected.data(), 10);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + 10, actual.begin()));
+
+    float *touched = new float[n];
+    FastMath::parallel::first_touch(pool, touched, n);
+    EXPECT_TRUE(std::all_of(touched, touched + n, [](float v) { return v == 0.0f; }));
+    delete[] touched;
+
+#ifdef __linux__
+    // A pinned pool runs participant 0 on the first allowed CPU, then gives
+    // the caller its own affinity back
+    cpu_set_t before;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(before), &before), 0);
+    int first_cpu = 0;
+    while (!CPU_ISSET(first_cpu, &before))
+    {
+        ++first_cpu;
+    }
+    FastMath::parallel::ThreadPool pinned(2, true);
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<int> caller_cpu_mismatches{0};
+    std::atomic<int> caller_tasks{0};
+    for (std::size_t tasks : {std::size_t(1), std::size_t(64)})
+    {
+        pinned.run(tasks, [&](std::size_t) {
+            if (std::this_thread::get_id() == caller)
+            {
+                ++caller_tasks;
+                caller_cpu_mismatches += (sched_getcpu() != first_cpu) ? 1 : 0;
+            }
+        });
+    }
+    EXPECT_GT(caller_tasks.load(), 0);
+    EXPECT_EQ(caller_cpu_mismatches.load(), 0);
+    cpu_set_t after;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(after), &after), 0);
+    EXPECT_TRUE(CPU_EQUAL(&before, &after)) << "caller affinity not restored";
+#endif
+}
+
+TEST_F(FastMathTest, ParallelPerformanceTest)
+{
+    const std::size_t n = 1 << 24;
+    std::vector<float> in(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        in[i] = -10.0f + 20.0f * static_cast<float>(i) / n;
+    }
+    std::vector<float> out(n);
+    FastMath::parallel::ThreadPool &pool = FastMath::parallel::default_pool();
+
+    std::cout << "\n=== Parallel Batch Performance Test ===" << std::endl;
+    std::cout << "Testing " << n << " elements on " << pool.size() << " threads" << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    FastMath::exp(in.data(), out.data(), n);
+    auto end = std::chrono::high_resolution_clock::now();
+    double batch_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    FastMath::parallel::transform(pool, in.data(), out.data(), n, FastMath::op::exp);
+    end = std::chrono::high_resolution_clock::now();
+    double parallel_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float sink = out[n / 2];
+    (void)sink;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "FastMath::exp batch time: " << batch_time << " ms" << std::endl;
+    std::cout << "FastMath::exp parallel time: " << parallel_time << " ms" << std::endl;
+    std::cout << "Speedup: " << batch_time / parallel_time << "x" << std::endl;
+}
+
+// fn:: objects behave like the scalar functions in std algorithms, and
+// FastMath::transform hands contiguous floats to the batch API
+TEST_F(FastMathTest, FunctorTransformTest)
+{
+    const std::size_t n = 50001;
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = -10.0f + 20.0f * static_cast<float>(i) / n;
+        y[i] = 3.0f - 6.0f * static_cast<float>(i) / n;
+    }
+
+    std::vector<float> expected(n);
+    std::vector<float> actual(n);
+
+    // Scalar semantics, usable anywhere a float(float) is
+    for (std::size_t i = 0; i < n; i += 97)
+    {
+        EXPECT_EQ(FastMath::fn::exp(x[i]), FastMath::exp(x[i]));
+        EXPECT_EQ(FastMath::fn::atan2(y[i], x[i]), FastMath::atan2(y[i], x[i]));
+    }
+    std::transform(x.begin(), x.end(), actual.begin(), FastMath::fn::tanh);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        expected[i] = FastMath::tanh(x[i]);
+    }
+    EXPECT_EQ(expected, actual);
+
+#if defined(__cpp_lib_execution)
+    std::fill(actual.begin(), actual.end(), 0.0f);
+    std::transform(std::execution::par_unseq, x.begin(), x.end(), actual.begin(), FastMath::fn::tanh);
+    EXPECT_EQ(expected, actual);
+
+    // Contiguous ranges take the batch path with every policy
+    FastMath::sin(x.data(), expected.data(), n);
+    std::fill(actual.begin(), actual.end(), 0.0f);
+    auto end = FastMath::transform(std::execution::par, x.begin(), x.end(), actual.begin(), FastMath::fn::sin);
+    EXPECT_EQ(end, actual.end());
+    EXPECT_EQ(expected, actual);
+    std::fill(actual.begin(), actual.end(), 0.0f);
+    FastMath::transform(std::execution::seq, x.data(), x.data() + n, actual.data(), FastMath::fn::sin);
+    EXPECT_EQ(expected, actual);
+
+    FastMath::atan2(y.data(), x.data(), expected.data(), n);
+    std::fill(actual.begin(), actual.end(), 0.0f);
+    FastMath::transform(std::execution::par_unseq, y.cbegin(), y.cend(), x.cbegin(), actual.begin(),
+                        FastMath::fn::atan2);
+    EXPECT_EQ(expected, actual);
+
+    // Other ranges fall back to std::transform with scalar calls
+    const std::deque<float> list(x.begin(), x.begin() + 1000);
+    std::vector<float> from_list(list.size());
+    FastMath::transform(std::execution::par, list.begin(), list.end(), from_list.begin(), FastMath::fn::log);
+    for (std::size_t i = 0; i < list.size(); ++i)
+    {
+        EXPECT_EQ(from_list[i], FastMath::log(list[i]));
+    }
+#endif
+}
+
+// Fused expressions match the same chain of batch calls with temporaries
+TEST_F(FastMathTest, ExpressionTest)
+{
+    using namespace FastMath::expr;
+
+    const std::size_t n = 10007; // Not a multiple of expr::tile
+    std::vector<float> x(n);
+    std::vector<float> y(n);
+    std::vector<float> c(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = -4.0f + 8.0f * static_cast<float>(i) / n;
+        y[i] = 3.0f - 6.0f * static_cast<float>(i) / n;
+        c[i] = 0.01f + 10.0f * static_cast<float>(i) / n;
+    }
+    const float s2 = 1.7f;
+    const float k = 0.4f;
+    const float heading = 0.25f;
+
+    auto expect_near = [](const std::vector<float> &expected, const std::vector<float> &actual, const char *name) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            ASSERT_NEAR(actual[i], expected[i], 1e-6f * std::max(1.0f, std::abs(expected[i])))
+                << name << " at " << i;
+        }
+    };
+
+    std::vector<float> t(n);
+    std::vector<float> expected(n);
+    std::vector<float> actual(n);
+
+    // exp(-0.5 * x * x / s2) * k
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        t[i] = -0.5f * x[i] * x[i] / s2;
+    }
+    FastMath::exp(t.data(), expected.data(), n);
+    for (float &v : expected)
+    {
+        v *= k;
+    }
+    const auto gauss = exp(-0.5f * view(x) * view(x) / s2) * k;
+    EXPECT_EQ(gauss.size(), n);
+    evaluate(gauss, actual.data());
+    expect_near(expected, actual, "gaussian");
+
+    // atan2(y, x) - heading
+    FastMath::atan2(y.data(), x.data(), expected.data(), n);
+    for (float &v : expected)
+    {
+        v -= heading;
+    }
+    evaluate(atan2(view(y), view(x)) - heading, actual.data());
+    expect_near(expected, actual, "atan2");
+
+    // exp(a * b) + log(c), and unary minus
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        t[i] = x[i] * y[i];
+    }
+    FastMath::exp(t.data(), expected.data(), n);
+    FastMath::log(c.data(), t.data(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        expected[i] = -(expected[i] + t[i]);
+    }
+    evaluate(-(exp(view(x) * view(y)) + log(view(c))), actual.data());
+    expect_near(expected, actual, "exp + log");
+
+    // Thread pool split, and evaluation in place over an input
+    std::fill(actual.begin(), actual.end(), 0.0f);
+    FastMath::parallel::ThreadPool pool(3);
+    evaluate(pool, atan2(view(y), view(x)) - heading, actual.data(), 1000);
+    FastMath::atan2(y.data(), x.data(), expected.data(), n);
+    for (float &v : expected)
+    {
+        v -= heading;
+    }
+    expect_near(expected, actual, "parallel atan2");
+
+    FastMath::sin(c.data(), expected.data(), n);
+    evaluate(sin(view(c)), c.data());
+    EXPECT_EQ(expected, c);
+
+    // The aliased input on the right of an operator must still be read
+    // before the tile is written: exp(x) + x and atan2(exp(y), y) in place
+    std::vector<float> aliased = x;
+    FastMath::exp(x.data(), expected.data(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        expected[i] += x[i];
+    }
+    evaluate(exp(view(aliased)) + view(aliased), aliased.data());
+    expect_near(expected, aliased, "exp(x) + x in place");
+
+    aliased = y;
+    FastMath::exp(y.data(), t.data(), n);
+    FastMath::atan2(t.data(), y.data(), expected.data(), n);
+    evaluate(atan2(exp(view(aliased)), view(aliased)), aliased.data());
+    expect_near(expected, aliased, "atan2(exp(y), y) in place");
+
+    aliased = x;
+    evaluate(pool, exp(view(aliased)) + view(aliased), aliased.data(), 1000);
+    FastMath::exp(x.data(), expected.data(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        expected[i] += x[i];
+    }
+    expect_near(expected, aliased, "parallel exp(x) + x in place");
+
+    // The shortest view bounds the result
+    EXPECT_EQ((view(x.data(), 10) + view(y)).size(), 10u);
+}
+
+TEST_F(FastMathTest, ExpressionPerformanceTest)
+{
+    using namespace FastMath::expr;
+
+    const std::size_t n = 1 << 22;
+    std::vector<float> a(n);
+    std::vector<float> b(n);
+    std::vector<float> c(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = -2.0f + 4.0f * static_cast<float>(i) / n;
+        b[i] = 1.5f - 3.0f * static_cast<float>(i) / n;
+        c[i] = 0.01f + 10.0f * static_cast<float>(i) / n;
+    }
+    std::vector<float> t1(n);
+    std::vector<float> t2(n);
+    std::vector<float> out(n);
+
+    std::cout << "\n=== Fused Expression Performance Test ===" << std::endl;
+    std::cout << "Testing exp(a * b) + log(c) over " << n << " elements" << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        t1[i] = a[i] * b[i];
+    }
+    FastMath::exp(t1.data(), t1.data(), n);
+    FastMath::log(c.data(), t2.data(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = t1[i] + t2[i];
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double chained_time = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    evaluate(exp(view(a) * view(b)) + log(view(c)), out.data());
+    end = std::chrono::high_resolution_clock::now();
+    double fused_time = std::chrono::duration<double, std::milli>(end - start).count();
+    volatile float sink = out[n / 2];
+    (void)sink;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Chained batch calls time: " << chained_time << " ms" << std::endl;
+    std::cout << "FastMath::expr fused time: " << fused_time << " ms" << std::endl;
+    std::cout << "Speedup: " << chained_time / fused_time << "x" << std::endl;
+}
+
+// Compile-time precision tiers must meet their documented error bounds
+TEST_F(FastMathTest, PrecisionTierTest)
+{
+    using FastMath::Precision;
+    const int num_samples = 200003;
+
+    // Error in units of the last place of the correctly rounded float result
+    auto ulp_error = [](float value, double reference) {
+        int exponent = std::ilogb(static_cast<float>(reference));
+        return std::abs(value - reference) / std::ldexp(1.0, exponent - 23);
+    };
+
+    std::cout << "\n=== Precision Tier Test ===" << std::endl;
+    std::cout << "Testing " << num_samples << " samples per function" << std::endl;
+
+    double sin_abs[3] = {};
+    double cos_abs[3] = {};
+    double sin_high_ulp = 0.0;
+    double cos_high_ulp = 0.0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float x = -100000.0f + (200000.0f * i / num_samples);
+        double s = std::sin(static_cast<double>(x));
+        double c = std::cos(static_cast<double>(x));
+        sin_abs[0] = std::max(sin_abs[0], std::abs(FastMath::sin<Precision::Low>(x) - s));
+        sin_abs[1] = std::max(sin_abs[1], std::abs(FastMath::sin<Precision::Medium>(x) - s));
+        sin_abs[2] = std::max(sin_abs[2], std::abs(FastMath::sin<Precision::High>(x) - s));
+        cos_abs[0] = std::max(cos_abs[0], std::abs(FastMath::cos<Precision::Low>(x) - c));
+        cos_abs[1] = std::max(cos_abs[1], std::abs(FastMath::cos<Precision::Medium>(x) - c));
+        cos_abs[2] = std::max(cos_abs[2], std::abs(FastMath::cos<Precision::High>(x) - c));
+        sin_high_ulp = std::max(sin_high_ulp, ulp_error(FastMath::sin<Precision::High>(x), s));
+        cos_high_ulp = std::max(cos_high_ulp, ulp_error(FastMath::cos<Precision::High>(x), c));
+
+        // Medium is the untemplated function
+        EXPECT_EQ(FastMath::sin<Precision::Medium>(x), FastMath::sin(x));
+    }
+
+    double exp_ulp[3] = {};
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float x = -87.0f + (175.0f * i / num_samples);
+        double e = std::exp(static_cast<double>(x));
+        exp_ulp[0] = std::max(exp_ulp[0], ulp_error(FastMath::exp<Precision::Low>(x), e));
+        exp_ulp[1] = std::max(exp_ulp[1], ulp_error(FastMath::exp<Precision::Medium>(x), e));
+        exp_ulp[2] = std::max(exp_ulp[2], ulp_error(FastMath::exp<Precision::High>(x), e));
+    }
+
+    double log_abs[2] = {};
+    double log_high_ulp = 0.0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float x = static_cast<float>(std::exp(-69.0 + 138.0 * i / num_samples));
+        double l = std::log(static_cast<double>(x));
+        log_abs[0] = std::max(log_abs[0], std::abs(FastMath::log<Precision::Low>(x) - l));
+        log_abs[1] = std::max(log_abs[1], std::abs(FastMath::log<Precision::Medium>(x) - l));
+        log_high_ulp = std::max(log_high_ulp, ulp_error(FastMath::log<Precision::High>(x), l));
+    }
+
+    double atan_abs[3] = {};
+    double atan2_abs[3] = {};
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float x = -1000.0f + (2000.0f * i / num_samples);
+        double a = std::atan(static_cast<double>(x));
+        atan_abs[0] = std::max(atan_abs[0], std::abs(FastMath::atan<Precision::Low>(x) - a));
+        atan_abs[1] = std::max(atan_abs[1], std::abs(FastMath::atan<Precision::Medium>(x) - a));
+        atan_abs[2] = std::max(atan_abs[2], std::abs(FastMath::atan<Precision::High>(x) - a));
+
+        float theta = -3.14f + (6.28f * i / num_samples);
+        float y = 5.0f * std::sin(theta);
+        float x2 = 5.0f * std::cos(theta);
+        double t = std::atan2(static_cast<double>(y), static_cast<double>(x2));
+        atan2_abs[0] = std::max(atan2_abs[0], std::abs(FastMath::atan2<Precision::Low>(y, x2) - t));
+        atan2_abs[1] = std::max(atan2_abs[1], std::abs(FastMath::atan2<Precision::Medium>(y, x2) - t));
+        atan2_abs[2] = std::max(atan2_abs[2], std::abs(FastMath::atan2<Precision::High>(y, x2) - t));
+
+        EXPECT_EQ(FastMath::atan2<Precision::Medium>(y, x2), FastMath::atan2(y, x2));
+    }
+
+    std::cout << std::setprecision(8);
+    std::cout << "sin abs error Low/Medium/High: " << sin_abs[0] << " / " << sin_abs[1] << " / " << sin_abs[2] << std::endl;
+    std::cout << "cos abs error Low/Medium/High: " << cos_abs[0] << " / " << cos_abs[1] << " / " << cos_abs[2] << std::endl;
+    std::cout << "sin/cos High ulp error: " << sin_high_ulp << " / " << cos_high_ulp << std::endl;
+    std::cout << "exp ulp error Low/Medium/High: " << exp_ulp[0] << " / " << exp_ulp[1] << " / " << exp_ulp[2] << std::endl;
+    std::cout << "log abs error Low/Medium: " << log_abs[0] << " / " << log_abs[1] << std::endl;
+    std::cout << "log High ulp error: " << log_high_ulp << std::endl;
+    std::cout << "atan abs error Low/Medium/High: " << atan_abs[0] << " / " << atan_abs[1] << " / " << atan_abs[2]
+              << std::endl;
+    std::cout << "atan2 abs error Low/Medium/High: " << atan2_abs[0] << " / " << atan2_abs[1] << " / " << atan2_abs[2]
+              << std::endl;
+
+    EXPECT_LT(sin_abs[0], 0.057);
+    EXPECT_LT(sin_abs[1], 0.0012);
+    EXPECT_LT(cos_abs[0], 0.057);
+    EXPECT_LT(cos_abs[1], 0.0012);
+    EXPECT_LT(sin_high_ulp, 2.5);
+    EXPECT_LT(cos_high_ulp, 2.5);
+    EXPECT_LT(exp_ulp[0], 1.1e5);
+    EXPECT_LT(exp_ulp[1], 90.0);
+    EXPECT_LT(exp_ulp[2], 2.0);
+    EXPECT_LT(log_abs[0], 1.9e-3);
+    EXPECT_LT(log_abs[1], 9e-6);
+    EXPECT_LT(log_high_ulp, 3.0);
+    EXPECT_LT(atan_abs[0], 4e-3);
+    EXPECT_LT(atan_abs[1], 4.5e-6);
+    EXPECT_LT(atan_abs[2], 2e-7);
+    EXPECT_LT(atan2_abs[0], 4e-3);
+    EXPECT_LT(atan2_abs[1], 4.5e-6);
+    EXPECT_LT(atan2_abs[2], 3e-7);
+}
+
+// Performance of the precision tiers relative to each other
+TEST_F(FastMathTest, PrecisionTierPerformanceTest)
+{
+    using FastMath::Precision;
+    const int num_iterations = 1000000;
+
+    std::vector<float> test_values;
+    test_values.reserve(num_iterations);
+    for (int i = 0; i < num_iterations; ++i)
+    {
+        test_values.push_back(-10.0f + (20.0f * i / num_iterations));
+    }
+
+    std::cout << "\n=== Precision Tier Performance Test ===" << std::endl;
+    std::cout << "Testing " << num_iterations << " iterations" << std::endl;
+
+    using Scalar = float (*)(float);
+    const std::vector<std::tuple<const char *, Scalar>> cases = {
+        {"exp<Low>", FastMath::exp<Precision::Low>},
+        {"exp<Medium>", FastMath::exp<Precision::Medium>},
+        {"exp<High>", FastMath::exp<Precision::High>},
+        {"sin<Low>", FastMath::sin<Precision::Low>},
+        {"sin<Medium>", FastMath::sin<Precision::Medium>},
+        {"sin<High>", FastMath::sin<Precision::High>},
+    };
+
+    for (const auto &c : cases)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        volatile float sum = 0.0f;
+        for (const auto &value : test_values)
+        {
+            sum += std::get<1>(c)(value);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        double time = std::chrono::duration<double, std::milli>(end - start).count();
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "FastMath::" << std::get<0>(c) << " time: " << time << " ms" << std::endl;
+    }
+}
+
 // Edge case tests
 TEST_F(FastMathTest, EdgeCaseTests)
 {